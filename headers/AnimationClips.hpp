@@ -0,0 +1,118 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include "TextureLoader.hpp"
+
+/**
+ * @brief shared animation clips and frame clock for entities
+ *
+ * Each animation frame image is loaded once into a texture and given an integer frame id. A clip is an array of
+ * frame ids with a frame duration, entities with the same animation textures (an archetype e.g. every Tree) share
+ * one clip. All clips are timed from one frame clock advanced once per frame, so finding an entities current
+ * texture is a division, a modulo and two array lookups, no strings, map lookups or disk reads while drawing.
+ *
+ * Loading is requested at level setup with load_clip(), never in draw(). Frame images are decoded on the
+ * TextureLoader threads and show its placeholder texture until they're uploaded.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "AnimationClips.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern AnimationClips animationClips;
+ * then in your globals.cpp as below
+ * AnimationClips animationClips(textureLoader);
+ *
+ * 3. Load a clip when a level is set up
+ * int clip = animationClips.load_clip(renderer, {"tile_0000.png", "tile_0001.png"}, 200);
+ *
+ * 4. Advance the clock once per frame then get each entities texture
+ * animationClips.advance(SDL_GetTicks());
+ * SDL_Texture *texture = animationClips.get_frame(clip, phase);
+ *
+ * 5. Destroy textures before destroying the renderer
+ * animationClips.clear();
+ *
+ * or keep the clips when the renderer is recreated
+ * animationClips.clear_textures();
+ * renderThread.recreate(SDL_RENDERER_ACCELERATED);
+ * animationClips.reload_textures(renderer);
+ */
+class AnimationClips
+{
+private:
+    struct Clip
+    {
+        std::vector<int> frames{}; /**< frame ids in play order */
+        Uint32 frameDuration{};    /**< ms each frame is shown */
+    };
+
+    TextureLoader &loader;                         /**< decodes frame images off the main thread */
+    RenderBackend *renderer{};                     /**< renderer the frame textures were created with */
+    std::vector<SDL_Texture *> frameTextures{};    /**< texture by frame id, the placeholder while loading, nullptr if the image failed to load */
+    std::vector<bool> frameLoaded{};               /**< false while frameTextures holds the loaders placeholder */
+    unsigned int generation{};                     /**< increased by clear() so loads finishing afterwards are dropped */
+    std::vector<std::string> framePaths{};         /**< image path by frame id for reload_textures() */
+    std::unordered_map<std::string, int> frameIds{}; /**< frame id by image path, only used while loading */
+    std::vector<Clip> clips{};                     /**< clips by clip id */
+    std::unordered_map<std::string, int> clipIds{};  /**< clip id by frame paths and duration, only used while loading */
+    Uint32 clock{};                                /**< shared frame clock in ms set by advance() */
+
+    int load_frame(RenderBackend *renderer, const std::string &filePath);
+    void request_frame(RenderBackend *renderer, int frameId);
+
+public:
+    /**
+     * @param loader texture loader that decodes the frame images
+     */
+    AnimationClips(TextureLoader &loader);
+    ~AnimationClips();
+    /**
+     * @brief load a clip's frames, or return the existing clip with the same frames and duration
+     *
+     * @param renderer renderer to create the frame textures with
+     * @param framePaths image paths in play order
+     * @param frameDuration ms each frame is shown
+     * @return clip id, or -1 if framePaths is empty
+     */
+    int load_clip(RenderBackend *renderer, const std::vector<std::string> &framePaths, Uint32 frameDuration);
+    /**
+     * @brief set the shared frame clock, call once per frame before get_frame()
+     *
+     * @param ticks current time in ms e.g. SDL_GetTicks()
+     */
+    void advance(Uint32 ticks);
+    /**
+     * @brief get the texture a clip shows at the current frame clock
+     *
+     * @param clipId clip id from load_clip()
+     * @param phase ms offset so entities sharing a clip don't animate in lockstep
+     * @return frame texture, nullptr for an invalid clip id
+     */
+    SDL_Texture *get_frame(int clipId, Uint32 phase) const;
+    /**
+     * @brief destroy the frame textures but keep clip and frame ids e.g. before the renderer is recreated
+     */
+    void clear_textures();
+    /**
+     * @brief load every frame texture again after clear_textures(), clip and frame ids stay the same
+     *
+     * @param renderer the new renderer
+     */
+    void reload_textures(RenderBackend *renderer);
+    /**
+     * @brief destroy all frame textures and forget all clips
+     */
+    void clear();
+};
@@ -0,0 +1,150 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <atomic>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+/**
+ * @brief the one owner of the SDL_mixer audio device
+ *
+ * Opens the mixer once for the whole program with a buffer size picked by a profile. The mixer buffer is the
+ * delay between Mix_PlayChannel() and hearing the sound, 4096 frames at 44100Hz is about 93ms while the low
+ * latency profile starts at 256 frames (about 6ms).
+ *
+ * A small buffer can underrun if the mixer thread is late. The mixers post mix callback times every buffer, a
+ * callback more than twice a buffer's duration after the previous one means the device ran dry and is counted
+ * as an underrun. When UNDERRUNS_TO_GROW underruns happen within UNDERRUN_WINDOW ms needs_larger_buffer()
+ * returns true and grow_buffer() doubles the buffer, up to the profile maximum, and reopens the device. Nothing
+ * else may use SDL_mixer while it's reopened, e.g. the music loading thread is paused around it. Reopening halts
+ * every sound and the music, so the caller starts them again afterwards.
+ *
+ * Nothing else should call Mix_OpenAudio() or Mix_CloseAudio().
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "AudioDevice.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern AudioDevice audioDevice;
+ * then in your globals.cpp as below, 44100Hz stereo
+ * AudioDevice audioDevice(44100, 2);
+ *
+ * 3. Open the device after Mix_Init()
+ * audioDevice.open(AudioDevice::Profile::LOW_LATENCY);
+ *
+ * 4. Check for underruns once per frame, growing the buffer with other mixer users paused and restarting audio
+ * if (audioDevice.needs_larger_buffer(SDL_GetTicks()))
+ * {
+ *     std::unique_lock<std::mutex> loadingPaused = musicManager.pause_loading();
+ *     if (audioDevice.grow_buffer(SDL_GetTicks()))
+ *     {
+ *         voiceManager.open();
+ *     }
+ * }
+ *
+ * 5. Close the device on exit after freeing sounds and music
+ * audioDevice.close();
+ */
+class AudioDevice
+{
+public:
+    /**
+     * @brief mixer buffer sizes to open the device with
+     */
+    enum class Profile
+    {
+        LOW_LATENCY, /**< starts at LOW_LATENCY_FRAMES, grows up to LOW_LATENCY_MAX_FRAMES on underruns */
+        STANDARD     /**< STANDARD_FRAMES, never grows */
+    };
+
+    static constexpr int LOW_LATENCY_FRAMES = 256;          /**< first buffer size of the low latency profile */
+    static constexpr int LOW_LATENCY_MAX_FRAMES = 1024;     /**< largest buffer the low latency profile grows to */
+    static constexpr int STANDARD_FRAMES = 4096;            /**< buffer size of the standard profile */
+    static constexpr unsigned int UNDERRUNS_TO_GROW = 3;    /**< underruns within UNDERRUN_WINDOW that grow the buffer */
+    static constexpr Uint32 UNDERRUN_WINDOW = 2000;         /**< ms underruns are counted over */
+    static constexpr unsigned int WARMUP_CALLBACKS = 8;     /**< callbacks after opening not checked, the device is still starting */
+
+private:
+    int requestedFrequency{};                  /**< sample rate asked for */
+    int requestedChannels{};                   /**< 1 mono, 2 stereo */
+    int frequency{};                           /**< sample rate the device opened with */
+    int bytesPerFrame{};                       /**< bytes of one sample for every channel */
+    Uint64 counterFrequency{};                 /**< SDL_GetPerformanceFrequency() */
+    Profile profile{};                         /**< profile passed to open() */
+    int bufferFrames{};                        /**< current mixer buffer size */
+    int maxBufferFrames{};                     /**< largest buffer update() grows to */
+    bool opened{};                             /**< Mix_OpenAudio() succeeded */
+
+    std::atomic<unsigned int> underruns{};     /**< late callbacks since the device was opened, written by the mixer thread */
+    std::atomic<unsigned int> callbacks{};     /**< callbacks since the device was opened, written by the mixer thread */
+    Uint64 lastCallback{};                     /**< performance counter of the previous callback, mixer thread only */
+    unsigned int previousUnderruns{};          /**< underruns before the last reopen */
+    unsigned int windowUnderruns{};            /**< underruns when the current window started */
+    Uint32 windowStart{};                      /**< ticks the current window started */
+
+    /**
+     * @brief Mix_SetPostMix() callback, runs on the mixer thread after every buffer is mixed
+     */
+    static void post_mix(void *device, Uint8 *stream, int length);
+    bool open_device();
+    void close_device();
+
+public:
+    /**
+     * @param frequency sample rate e.g. 44100
+     * @param channels 1 mono, 2 stereo
+     */
+    AudioDevice(int frequency, int channels);
+    ~AudioDevice();
+    /**
+     * @brief open the mixer with the profiles first buffer size
+     *
+     * @param profile LOW_LATENCY or STANDARD buffer sizes
+     * @return true if the device opened
+     */
+    bool open(Profile profile);
+    /**
+     * @brief close the mixer, call after every sound and track is freed
+     */
+    void close();
+    /**
+     * @brief check if the device keeps underrunning and the buffer can still grow, call once per frame
+     *
+     * @param ticks current time in ms e.g. SDL_GetTicks()
+     * @return true if grow_buffer() should be called
+     */
+    bool needs_larger_buffer(Uint32 ticks);
+    /**
+     * @brief double the buffer up to the profile maximum and reopen the device
+     *
+     * Closes the mixer, nothing else may call SDL_mixer e.g. Mix_LoadMUS() on another thread until it returns
+     *
+     * @param ticks current time in ms e.g. SDL_GetTicks()
+     * @return true if the device was reopened, every channel and the music were halted
+     */
+    bool grow_buffer(Uint32 ticks);
+    /**
+     * @brief true if the device is open
+     */
+    bool is_open() const;
+    /**
+     * @brief current mixer buffer size in frames
+     */
+    int get_buffer_frames() const;
+    /**
+     * @brief ms of audio in one mixer buffer, the delay before a sound is heard
+     */
+    float get_latency() const;
+    /**
+     * @brief underruns detected since the first open()
+     */
+    unsigned int get_underrun_count() const;
+};
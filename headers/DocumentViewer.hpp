@@ -0,0 +1,104 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief scrollable text document viewer for help, credits and policy screens
+ *
+ * Each document is read from disk once and word wrapped by pixel width for the font it's drawn with.
+ * Only the lines inside the visible area are drawn, each wrapped line is rasterised into its own texture
+ * the first time it scrolls into view, and textures of lines that scroll well out of view are destroyed.
+ * So scrolling only costs the newly exposed lines.
+ *
+ * Documents are wrapped again when the font or wrap width changes e.g. changing font size or resizing the window.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "DocumentViewer.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern DocumentViewer documentViewer;
+ * then in your globals.cpp as below
+ * DocumentViewer documentViewer{};
+ *
+ * 3. Draw a document in a scene draw function, scrollYpos moves the document up/down
+ * SDL_Rect area = {SCREEN_WIDTH * 0.1, SCREEN_WIDTH * 0.2, SCREEN_WIDTH * 0.8, SCREEN_HEIGHT};
+ * documentViewer.draw(renderer, "README.md", area, scrollYpos, defaultFont, {0, 0, 0, 255});
+ *
+ * 4. Destroy line textures before destroying the renderer
+ * documentViewer.clear_textures();
+ */
+class DocumentViewer
+{
+private:
+    struct LineTexture
+    {
+        SDL_Texture *texture{};
+        int width{};
+        int height{};
+    };
+    struct Document
+    {
+        std::vector<std::string> paragraphs{};      /**< file lines as read from disk */
+        std::vector<std::string> lines{};           /**< paragraphs word wrapped to wrapWidth */
+        TTF_Font *wrapFont{};                       /**< font lines were wrapped with */
+        int wrapWidth{};                            /**< pixel width lines were wrapped to */
+        int lineHeight{};                           /**< line spacing of wrapFont */
+        SDL_Color textureColor{};                   /**< color the cached line textures were rendered with */
+        std::unordered_map<size_t, LineTexture> textures{}; /**< rasterised lines near the visible area by line index */
+        bool loaded{};                              /**< false if the file couldn't be opened */
+    };
+
+    std::unordered_map<std::string, Document> documents{}; /**< documents by file path */
+    static const int cachedLinesMargin = 20; /**< lines kept rasterised above and below the visible area */
+
+    Document &load_document(const std::string &filePath);
+    void wrap_document(Document &document, TTF_Font *font, int width);
+    static void destroy_line_textures(Document &document);
+
+public:
+    DocumentViewer();
+    ~DocumentViewer();
+    /**
+     * @brief draw the visible lines of a document
+     *
+     * @param renderer renderer to draw on
+     * @param filePath document to draw, read from disk the first time it's drawn
+     * @param area x, y of the first line, w to wrap lines to, lines below y + h are not drawn
+     * @param scrollY offset added to y, negative values scroll down the document
+     * @param font font to draw with
+     * @param color text color
+     * @return false if the document couldn't be loaded
+     */
+    bool draw(RenderBackend *renderer, const std::string &filePath, const SDL_Rect &area, int scrollY, TTF_Font *font, SDL_Color color);
+    /**
+     * @brief destroy all line textures, documents stay loaded
+     *
+     * call before the renderer is destroyed or recreated
+     */
+    void clear_textures();
+    /**
+     * @brief word wrap a UTF-8 string by pixel width
+     *
+     * Breaks between words, words wider than width are broken between UTF-8 characters
+     *
+     * @param text paragraph to wrap
+     * @param font font used to measure
+     * @param width max line width in pixels
+     * @return wrapped lines, at least one line even if text is empty
+     */
+    static std::vector<std::string> wrap_text(const std::string &text, TTF_Font *font, int width);
+};
@@ -14,11 +14,15 @@
 #include <algorithm> // for std::min/max
 #include <unordered_map>
 #include <chrono>
+#include <random>  // for the random animationPhase
 #include <ctime>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_mixer.h>
+#include "AnimationClips.hpp"
+#include "SoundBank.hpp"
+#include "VoiceManager.hpp"
 
 // Forward declarations
 class Item;
@@ -72,13 +76,15 @@ class Obstacle;
 class Entity
 {
 protected:
-    SDL_Renderer *renderer{};                                       /**< pointer to renderer set with set_renderer() for drawing entity */
+    RenderBackend *renderer{};                                      /**< pointer to renderer set with set_renderer() for drawing entity */
     const std::string name{};                                       /**< name of object e.g. Player1, or enemy2 */
     SDL_Rect rect{};                                                /**< entity x-pos, y-pos, width and length */
     int health{};                                                   /**< entities in game health */
     std::string collisionSoundString{};                             /**< file path of collission sound .wav */
     std::vector<std::string> walkingTextures{};                     /**< for animation */
-    Mix_Chunk *collisionSound{};                                    /**< holds collission sound .wav in SDL_mixer format */
+    Mix_Chunk *collisionSound{};                                    /**< holds collission sound .wav in SDL_mixer format, shared through soundBank */
+    SoundBank *soundBank{};                                         /**< bank collisionSound was acquired from, released on destruction */
+    VoiceManager *voiceManager{};                                   /**< plays collisionSound, set with set_sound() */
     SDL_Texture *texture{};                                         /**< holds texture value of  walkingTextures */
     float xVelocity{};                                              /**< x-pos velocity of entity */
     float yVelocity{};                                              /**< y-pos velocity of entity */
@@ -91,11 +97,9 @@ protected:
     std::vector<Skill *> skills{};                                  /**< inventory of all skills subclasses picked up */
     std::vector<Item *> notes{};                                    /**< inventory of all journal subclasses picked up for quests/jobs/notes */
     bool hasCollided{};                                             /**< On player collied with unpassable object set this flag true as API for controller rumble */
-    int currentAnimationFrame{};                                    /**< for animation */
-    std::chrono::steady_clock::time_point lastFrameChange{};        /**< for animation */
+    int animationClip = -1;                                         /**< AnimationClips clip id of walkingTextures, -1 until preload_textures() */
+    Uint32 animationPhase{};                                        /**< ms offset into the clip so entities sharing it don't animate in lockstep */
     const int animationDelay = 200;                                 /**< for animation */
-    std::string texturePath{};                                      /**< for animation */
-    std::unordered_map<std::string, SDL_Texture *> textureMap{};    /**< for animation */
     int zPos{};                                                     /**< 3D Height position. Cannot represent in member SDL_Rect rect */
     float acceleration = 0.5f;                                      /**< value to modify velocity for moving entity */
     float Decceleration = 0.01f;                                    /**< value to modify velocity for moving entity */
@@ -108,103 +112,81 @@ public:
     Entity(const std::string name, int x, int y, int width, int height, int health, std::string collisionSoundString, const std::vector<std::string> &walkingTextures) : name(name), rect({x, y, width, height}), health(health), collisionSoundString(collisionSoundString), walkingTextures(walkingTextures)
     {
         std::cout << "Success: Constructed Entity object: " << name << std::endl;
-        lastFrameChange = std::chrono::steady_clock::now();
     }
     /**
      * @brief Entity class deconstructor
      *
      */
-    virtual ~Entity() {}
-    /**
-     * @brief for changingn entity animations calculate difference between last frame rate
-     *
-     */
-    void update_animation()
+    virtual ~Entity()
     {
-        auto currentTime = std::chrono::steady_clock::now();
-        auto elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastFrameChange).count();
-
-        if (elapsedTime >= animationDelay)
+        if (soundBank)
         {
-            lastFrameChange = currentTime;
-            currentAnimationFrame = (currentAnimationFrame + 1) % walkingTextures.size();
-
-            texturePath = walkingTextures[currentAnimationFrame];
+            soundBank->release(collisionSoundString);
         }
     }
     /**
-     * @brief load Entity animations into vector from constructor passed file path
+     * @brief set current animation texture from the shared animation clock
+     *
+     * Only integer math and array lookups, textures are loaded beforehand by preload_textures()
+     *
+     * @param clips shared clips advanced once per frame with AnimationClips::advance()
      */
-    void preload_textures()
+    void update_animation(const AnimationClips &clips)
     {
-        for (const auto &filePath : walkingTextures)
+        if (animationClip >= 0)
         {
-            if (textureMap.find(filePath) == textureMap.end())
-            {
-                // Texture not found, load it
-                texture = IMG_LoadTexture(renderer, filePath.c_str());
-                if (!texture)
-                {
-                    std::cerr << "Error: Failed to load texture: " << filePath << IMG_GetError() << std::endl;
-                }
-                else
-                {
-                    // Texture loaded successfully, store it in the map
-                    textureMap[filePath] = texture;
-                    // std::cout << "Success: Texture loaded: " << filePath << std::endl;
-                }
-            }
+            texture = clips.get_frame(animationClip, animationPhase);
         }
     }
     /**
-     * @brief set current animation texture from vector
+     * @brief load Entity animation textures from constructor passed file paths into a shared clip
+     *
+     * Entities with the same walkingTextures share one clip, call at level setup not in draw()
      *
+     * @param clips shared clips to load into
+     * @param gen random generator for a start phase so entities sharing the clip don't animate in lockstep
      */
-    void set_animation_texture()
+    void preload_textures(AnimationClips &clips, std::mt19937 &gen)
     {
-        if (!texturePath.empty())
-        {
-            // Try to find texture in the map
-            auto it = textureMap.find(texturePath);
-            if (it != textureMap.end())
-            {
-                // Texture found in the map, use it
-                texture = it->second;
-            }
-            else
-            {
-                // Texture not found, load it
-                texture = IMG_LoadTexture(renderer, texturePath.c_str());
-                if (!texture)
-                {
-                    std::cerr << "Error: Failed to load texture: " << texturePath << IMG_GetError() << std::endl;
-                }
-                else
-                {
-                    // Texture loaded successfully, store it in the map
-                    textureMap[texturePath] = texture;
-                    std::cout << "Success: Texture loaded: " << texturePath << std::endl;
-                }
-            }
-        }
+        animationClip = clips.load_clip(renderer, walkingTextures, animationDelay);
+        animationPhase = std::uniform_int_distribution<Uint32>(0, animationDelay - 1)(gen);
+        update_animation(clips);
     }
     /**
      * @brief dynamically set renderer
-     * @param r pass a SDL_Renderer *r object for this entity to render on with render_texture()
+     * @param r pass a RenderBackend *r object for this entity to render on with render_texture()
      * */
-    void set_renderer(SDL_Renderer *r)
+    void set_renderer(RenderBackend *r)
     {
         renderer = r;
     }
     /**
-     * @brief load entity sound into private member variable passed from constructor
+     * @brief get entity sound passed from constructor from a shared bank, only decoded if no one else uses it
+     *
+     * Entities with the same collisionSoundString share one Mix_Chunk, call at level setup, calling again is a no-op
+     *
+     * @param sounds shared sound bank, released from when the entity is destroyed
+     * @param voices plays the sound, coalescing entities colliding on the same frame
+     */
+    void set_sound(SoundBank &sounds, VoiceManager &voices)
+    {
+        voiceManager = &voices;
+        if (soundBank)
+        {
+            return;
+        }
+        soundBank = &sounds;
+        collisionSound = soundBank->acquire(collisionSoundString);
+    }
+    /**
+     * @brief request collision sound at the entity centre, started with any other requests for it this frame by
+     * VoiceManager::flush(), panned and attenuated from the camera or culled if too far away
      */
-    void set_sound()
+    void play_collision_sound()
     {
-        collisionSound = Mix_LoadWAV(collisionSoundString.c_str());
-        if (collisionSound == nullptr)
+        if (voiceManager)
         {
-            std::cerr << "Error: Failed to load sound: " << collisionSound << ": " << Mix_GetError() << std::endl;
+            voiceManager->play_at(collisionSound, rect.x + rect.w / 2.0f, rect.y + rect.h / 2.0f);
         }
     }
     /**
@@ -213,8 +195,7 @@ public:
      * EXAMPLE
      *
      * draw() {
-     *    player1.update_animation();
-     *    player1.set_animation_texture();
+     *    player1.update_animation(animationClips);
      *    player1.render_texture(player1.get_rect());
      * }
      *
@@ -222,8 +203,8 @@ public:
      */
     void render_texture(int x, int y)
     {
-        SDL_Rect cameraDisplacement = {x, y, get_rect().w, get_rect().y};
-        SDL_RenderCopy(renderer, texture, nullptr, &cameraDisplacement);
+        SDL_Rect cameraDisplacement = {x, y, get_rect().w, get_rect().h};
+        renderer->copy(texture, nullptr, &cameraDisplacement);
     }
 
     /**
@@ -515,6 +496,17 @@ public:
      * @return rect x-pos, y-pos, width and height of the entity for collission/rendering etc., logic
      */
     SDL_Rect get_rect() const { return rect; }
+    /**
+     * @brief get current animation texture set by update_animation()
+     *
+     * @return texture render_texture() would draw e.g. to publish it in a RenderSnapshots.hpp snapshot
+     */
+    SDL_Texture *get_texture() const { return texture; }
+    /**
+     * @brief get number of animation textures passed from constructor
+     * @return 1 or less for entities that never change texture e.g. to bake them into the StaticLayer.hpp chunks
+     */
+    size_t get_animation_frame_count() const { return walkingTextures.size(); }
     /**
      * @brief get entity Z position
      * @return rect z position e.g. for jumping
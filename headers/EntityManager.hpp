@@ -94,39 +94,39 @@ public:
      *
      * Generate a player object entity
      */
-    static void create_player_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int playerCount);
+    static void create_player_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int playerCount);
     /**
      * @brief create a bot entity
      *
      * Generate a bot object entity
      */
-    static void create_bot_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int playerCount);
+    static void create_bot_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int playerCount);
 
     /**
      * @brief create a item heart entity
      *
      * Generate a item heart object entity
      */
-    static void create_item_heart_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
+    static void create_item_heart_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
 
     /**
      * @brief Random creation logic for item entities
      *
      * function for randomly generating item entities objects
      */
-    static void create_random_item_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
+    static void create_random_item_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
     /**
      * @brief Random creation logic for enemy entities
      *
      * function for randomly generating enemy entities objects
      */
-    static void create_random_enemy_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
+    static void create_random_enemy_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
     /**
      * @brief Random creation logic for obstacle entities
      *
      * function for randomly generating obstacle entities objects
      */
-    static void create_random_obstacle_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
+    static void create_random_obstacle_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT);
     /**
      * @brief random procedurally generate non player entities
      *
@@ -144,5 +144,5 @@ public:
      * EntityManager::random_procedural_generation(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 10, 10, 10);
      *
      */
-    static void random_procedural_generation(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int itemsCount, int enemiesCount, int obstaclesCount);
+    static void random_procedural_generation(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int itemsCount, int enemiesCount, int obstaclesCount);
 };
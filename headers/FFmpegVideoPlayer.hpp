@@ -14,6 +14,7 @@
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_mixer.h>
+#include "RenderBackend.hpp"
 extern "C"
 {
 #include <libavformat/avformat.h>
@@ -34,7 +35,7 @@ private:
     const char *videoFile{};         /**< the video filepath to play */
     const char *musicFile{};         /**< the audio filepath to play, split from video, currently this code is not working to isolate audio stream requires manual splitting */
     SDL_Window *window{};            /**< the SDL Window to play the video on passed as a reference in an existing SDL app */
-    SDL_Renderer *renderer{};        /**< the SDL renderer to play the video on passed as a reference in an existing SDL app */
+    RenderBackend *renderer{};       /**< the renderer to play the video on passed as a reference in an existing SDL app */
     AVFormatContext *formatCtx{};    /**< the video file */
     int videoStreamIndex{};          /**< the found and split video stream */
     int audioStreamIndex{};          /**< the found and split audio stream */
@@ -48,7 +49,7 @@ public:
     /**
      * @brief default FFmpegVideoPlayer constructor
      */
-    FFmpegVideoPlayer(const char *videoFile, const char *musicFile, SDL_Window *window, SDL_Renderer *renderer)
+    FFmpegVideoPlayer(const char *videoFile, const char *musicFile, SDL_Window *window, RenderBackend *renderer)
         : videoFile(videoFile), musicFile(musicFile), window(window), renderer(renderer), formatCtx(nullptr),
           videoStreamIndex(-1), audioStreamIndex(-1), videoCodec(nullptr), audioCodec(nullptr),
           videoCodecCtx(nullptr), audioCodecCtx(nullptr), music(nullptr)
@@ -157,10 +158,13 @@ public:
                 return;
             }
 
-            // Initialize SDL Mixer
-            if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 4096) == -1)
+            // SDL Mixer must already be open, the program owns the audio device not the player
+            int frequency{};
+            Uint16 format{};
+            int channels{};
+            if (Mix_QuerySpec(&frequency, &format, &channels) == 0)
             {
-                std::cerr << "Error: Failed to open audio channel: " << Mix_GetError() << std::endl;
+                std::cerr << "Error: Audio device not open, call Mix_OpenAudio before playing a video" << std::endl;
                 return;
             }
 
@@ -195,7 +199,6 @@ public:
         {
             Mix_FreeMusic(music);
         }
-        Mix_CloseAudio();
     }
 
     /**
@@ -203,7 +206,7 @@ public:
      *
      * The audio playback pipeline is below
      *
-     * Original file -> split into videoFile/musicFile -> musicFile -> initialise SDL_Mixer -> Mix_PlayMusic -> playAudio() -> playVideo() {playAudio()}
+     * Original file -> split into videoFile/musicFile -> musicFile -> SDL_Mixer opened by the program -> Mix_PlayMusic -> playAudio() -> playVideo() {playAudio()}
      */
     void playAudio() const
     {
@@ -235,9 +238,11 @@ public:
             return;
         }
 
+        RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::VIDEO);
+
         // Create SDL texture
-        SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_YV12, SDL_TEXTUREACCESS_STREAMING,
-                                                 videoCodecCtx->width, videoCodecCtx->height);
+        SDL_Texture *texture = renderer->create_texture(SDL_PIXELFORMAT_YV12, SDL_TEXTUREACCESS_STREAMING,
+                                                        videoCodecCtx->width, videoCodecCtx->height);
         if (texture == nullptr)
         {
             std::cerr << "Error: Could not create SDL texture: " << SDL_GetError() << std::endl;
@@ -266,17 +271,17 @@ public:
                     avcodec_send_packet(videoCodecCtx, &packet);
                     avcodec_receive_frame(videoCodecCtx, frame);
 
-                    SDL_RenderClear(renderer);
+                    renderer->clear();
 
                     // Update the video texture
-                    SDL_UpdateYUVTexture(texture, nullptr,
+                    renderer->update_yuv_texture(texture, nullptr,
                                          frame->data[0], frame->linesize[0],
                                          frame->data[1], frame->linesize[1],
                                          frame->data[2], frame->linesize[2]);
 
                     // Render the video frame
-                    SDL_RenderCopy(renderer, texture, nullptr, nullptr);
-                    SDL_RenderPresent(renderer);
+                    renderer->copy(texture, nullptr, nullptr);
+                    renderer->present();
 
                     // Delay the video so that it plays at the same speed as video stream
                     SDL_Delay((Uint32)(frame_delay * 1000)); // Convert to milliseconds
@@ -315,6 +320,6 @@ public:
 
         // Cleanup
         av_frame_free(&frame);
-        SDL_DestroyTexture(texture);
+        renderer->destroy_texture(texture);
     }
 };
@@ -0,0 +1,110 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief glyph atlas text renderer for strings that change often
+ *
+ * Strings such as "FPS: 60", timers "01:59" and "Score: 3" are different every few frames so caching
+ * the whole string texture (see TextCache) rasterises them again anyway. This class rasterises each glyph
+ * once per font into an atlas texture, then lays strings out as textured quads with kerning and draws
+ * them in a single SDL_RenderGeometry() call per atlas page.
+ *
+ * Every font size in this project is its own TTF_Font (font24, font36 etc.,) so atlases are keyed per
+ * TTF_Font pointer. Glyphs are inserted on demand so CJK and Ge'ez fonts only store glyphs actually drawn.
+ *
+ * Scripts that need text shaping (Arabic, Devanagari, Thai) can't be drawn glyph by glyph, draw_text()
+ * returns false for them so the caller can fall back to render_text()
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "GlyphAtlas.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern GlyphAtlas glyphAtlas;
+ * then in your globals.cpp as below
+ * GlyphAtlas glyphAtlas{};
+ *
+ * 3. Draw text
+ * glyphAtlas.draw_text(renderer, "FPS: " + std::to_string(fps), 100, 100, {0, 0, 0, 255}, defaultFont);
+ *
+ * 4. Destroy atlas textures before destroying the renderer
+ * glyphAtlas.clear();
+ */
+class GlyphAtlas
+{
+private:
+    struct Glyph
+    {
+        int page{};    /**< index of the atlas page texture */
+        SDL_Rect src{}; /**< glyph position in the atlas page */
+        int advance{}; /**< horizontal pen advance */
+    };
+    struct FontAtlas
+    {
+        std::vector<SDL_Texture *> pages{};         /**< atlas textures, a new page is added when full */
+        std::unordered_map<Uint32, Glyph> glyphs{}; /**< codepoint to glyph */
+        int shelfX{};      /**< next free x on the current shelf */
+        int shelfY{};      /**< top of the current shelf */
+        int shelfHeight{}; /**< tallest glyph on the current shelf */
+    };
+
+    static const int pageSize = 1024; /**< atlas page width and height in pixels */
+    std::unordered_map<TTF_Font *, FontAtlas> atlases{};
+    RenderBackend *renderer{};                       /**< renderer the atlas pages were created with, for clear() */
+    std::vector<std::vector<SDL_Vertex>> vertices{}; /**< per page vertex batch, reused between calls */
+    std::vector<std::vector<int>> indices{};         /**< per page index batch, reused between calls */
+
+    const Glyph *find_or_add_glyph(RenderBackend *renderer, TTF_Font *font, FontAtlas &atlas, Uint32 codepoint);
+
+public:
+    GlyphAtlas();
+    ~GlyphAtlas();
+    /**
+     * @brief draw a UTF-8 string with glyphs from the atlas
+     *
+     * @param renderer renderer to draw on, also used to create atlas pages
+     * @param text UTF-8 string to draw
+     * @param x left of the string
+     * @param y top of the string
+     * @param color text color applied to the vertices
+     * @param font font to draw with
+     * @return false if the string needs shaping or a glyph couldn't be rasterised and nothing was drawn
+     */
+    bool draw_text(RenderBackend *renderer, const std::string &text, int x, int y, SDL_Color color, TTF_Font *font);
+    /**
+     * @brief destroy all atlas pages
+     *
+     * call before the renderer is destroyed or recreated
+     */
+    void clear();
+    /**
+     * @brief decode a UTF-8 string into unicode codepoints
+     *
+     * invalid bytes are replaced with U+FFFD
+     *
+     * @param text UTF-8 string
+     * @return codepoints of text
+     */
+    static std::vector<Uint32> decode_utf8(const std::string &text);
+    /**
+     * @brief check if a codepoint belongs to a script that needs shaping e.g. Arabic, Devanagari, Thai
+     *
+     * @param codepoint unicode codepoint
+     * @return true if glyph by glyph layout would be wrong for this codepoint
+     */
+    static bool needs_shaping(Uint32 codepoint);
+};
@@ -0,0 +1,149 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief RenderBackend that records draw calls without a window, GPU or rasterising anything
+ *
+ * Draw calls only record a Command and are counted by category, textures are handles that remember their size
+ * and no pixels are kept, so the whole game loop can run on CI boxes with SDL_VIDEODRIVER=dummy as fast as the
+ * simulation goes. Benchmarks and tests read the draw call counts and the last frames commands instead of
+ * looking at pixels. Textures are counted so tests can check nothing leaked, a texture another backend created
+ * or one already destroyed is reported when destroyed.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "HeadlessRenderer.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern HeadlessRenderer headlessRenderer;
+ * then in your globals.cpp as below
+ * HeadlessRenderer headlessRenderer{};
+ *
+ * 3. Create it with the frame size and draw through it like any RenderBackend
+ * headlessRenderer.create(SCREEN_WIDTH, SCREEN_HEIGHT);
+ * renderer = &headlessRenderer;
+ *
+ * 4. Read what was drawn after present()
+ * headlessRenderer.get_last_frame_commands();
+ * headlessRenderer.get_total_draw_calls(RenderBackend::DrawCategory::SPRITES);
+ *
+ * 5. Destroy on exit, freeing every texture handle
+ * headlessRenderer.destroy();
+ */
+class HeadlessRenderer : public RenderBackend
+{
+public:
+    /**
+     * @brief kind of draw call recorded
+     */
+    enum class CommandType
+    {
+        CLEAR,
+        FILL_RECTS,
+        DRAW_RECT,
+        DRAW_LINE,
+        COPY,
+        GEOMETRY
+    };
+
+    struct Command
+    {
+        CommandType type{};          /**< draw call */
+        DrawCategory category{};     /**< category it was counted under */
+        SDL_Texture *texture{};      /**< texture copied or drawn with geometry, nullptr for colour draws */
+        SDL_Texture *target{};       /**< render target drawn into, nullptr for the frame */
+        SDL_Rect rect{};             /**< destination rect, the first rect of FILL_RECTS, empty if the whole target */
+    };
+
+private:
+    struct Texture
+    {
+        Uint32 format{};             /**< pixel format it was created with */
+        int access{};                /**< SDL_TEXTUREACCESS_* it was created with */
+        int w{};                     /**< width in pixels */
+        int h{};                     /**< height in pixels */
+        SDL_BlendMode blendMode{};   /**< set_texture_blend_mode() */
+    };
+
+    int width{};                                  /**< frame width given to create() */
+    int height{};                                 /**< frame height given to create() */
+    bool created{};                               /**< create() was called and destroy() wasn't */
+    std::unordered_set<Texture *> textures{};     /**< live texture handles */
+    SDL_Texture *target{};                        /**< set_target() */
+    SDL_Rect viewport{};                          /**< set_viewport(), empty for the whole target */
+    SDL_Rect clipRect{};                          /**< set_clip_rect(), empty when clipping is disabled */
+    SDL_Color drawColor{};                        /**< set_draw_color() */
+    SDL_BlendMode drawBlendMode{};                /**< set_draw_blend_mode() */
+    std::vector<Command> commands{};              /**< commands recorded this frame */
+    std::vector<Command> lastFrameCommands{};     /**< commands of the last presented frame */
+
+    /**
+     * @brief handle of a texture this backend created, nullptr and reported if it isn't one
+     */
+    Texture *find_texture(SDL_Texture *texture, const char *caller) const;
+    void record(CommandType type, SDL_Texture *texture, const SDL_Rect *rect);
+
+protected:
+    int draw_clear() override;
+    int draw_fill_rects(const SDL_Rect *rects, int count) override;
+    int draw_outline_rect(const SDL_Rect *rect) override;
+    int draw_line_segment(int x1, int y1, int x2, int y2) override;
+    int draw_copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst) override;
+    int draw_geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount) override;
+    void present_frame() override;
+
+public:
+    HeadlessRenderer();
+    ~HeadlessRenderer();
+    /**
+     * @brief start recording frames of a size, destroys any previous textures
+     *
+     * @param width frame width in pixels e.g. SCREEN_WIDTH
+     * @param height frame height in pixels e.g. SCREEN_HEIGHT
+     * @return always true, nothing can fail without a GPU
+     */
+    bool create(int width, int height);
+    /**
+     * @brief free every texture handle, statistics are kept
+     */
+    void destroy();
+
+    int set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a) override;
+    int get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a) override;
+    int set_draw_blend_mode(SDL_BlendMode blendMode) override;
+    int get_draw_blend_mode(SDL_BlendMode *blendMode) override;
+    int set_target(SDL_Texture *texture) override;
+    SDL_Texture *get_target() override;
+    int set_viewport(const SDL_Rect *rect) override;
+    void get_viewport(SDL_Rect *rect) override;
+    int set_clip_rect(const SDL_Rect *rect) override;
+    int get_output_size(int *w, int *h) override;
+
+    SDL_Texture *create_texture(Uint32 format, int access, int w, int h) override;
+    SDL_Texture *create_texture_from_surface(SDL_Surface *surface) override;
+    int update_texture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch) override;
+    int update_yuv_texture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *yPlane, int yPitch, const Uint8 *uPlane, int uPitch, const Uint8 *vPlane, int vPitch) override;
+    int set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode) override;
+    void destroy_texture(SDL_Texture *texture) override;
+
+    /**
+     * @brief commands recorded in the last presented frame
+     */
+    const std::vector<Command> &get_last_frame_commands() const;
+    /**
+     * @brief live texture handles, 0 once everything was destroyed
+     */
+    size_t get_texture_count() const;
+};
@@ -0,0 +1,105 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "buttons/BaseButton.hpp"
+
+/**
+ * @brief retained mode compositor for the static menu scenes
+ *
+ * Menu scenes redraw the background, every button and label every frame even though nothing changes
+ * between input events. This class draws a scene once into a render target texture and reuses it while
+ * the scenes signature (e.g. window size, language, font, text drawn outside buttons) stays the same.
+ *
+ * While composing, every button drawn is recorded from BaseButton::drawnButtons with its
+ * get_draw_signature(). Each frame the buttons whose signature changed (selected highlight, slider dot,
+ * input text) mark their old and new rect dirty, and only those regions of the cached texture are drawn
+ * again with a clip rect, so a menu frame is a single full screen copy.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "MenuCompositor.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern MenuCompositor menuCompositor;
+ * then in your globals.cpp as below
+ * MenuCompositor menuCompositor{};
+ *
+ * 3. Draw a scene, the function is only called when the signature or a drawn button changes
+ * menuCompositor.draw_scene(renderer, scene, signature, []() { draw_scene_1(); });
+ *
+ * 4. Destroy cached scenes before destroying the renderer
+ * menuCompositor.clear();
+ */
+class MenuCompositor
+{
+private:
+    struct DrawnButton
+    {
+        BaseButton *button{};     /**< button drawn into the texture */
+        SDL_Rect area{};          /**< every rect it was drawn at including the selected border */
+        size_t signature{};       /**< get_draw_signature() when it was drawn */
+    };
+
+    struct CachedScene
+    {
+        SDL_Texture *texture{};             /**< render target with the scenes content */
+        int width{};                        /**< texture width, rebuilt when the window size changes */
+        int height{};                       /**< texture height, rebuilt when the window size changes */
+        size_t signature{};                 /**< state the texture was composed with */
+        std::vector<DrawnButton> buttons{}; /**< buttons drawn into the texture, checked every frame */
+    };
+
+    std::unordered_map<int, CachedScene> scenes{}; /**< cached scenes by scene number */
+    RenderBackend *renderer{};                     /**< renderer the scene textures were created with, for clear() */
+
+    /**
+     * @brief draw the scene into its texture, clipped to a dirty rect or all of it
+     *
+     * @param cached scene to draw into, its buttons are recorded again
+     * @param drawScene draws the scenes full content
+     * @param clip region to draw again, nullptr clears and draws the whole texture
+     */
+    void compose(CachedScene &cached, const std::function<void()> &drawScene, const SDL_Rect *clip);
+
+public:
+    MenuCompositor();
+    ~MenuCompositor();
+    /**
+     * @brief draw a menu scene from cache or compose it again if the signature changed
+     *
+     * @param renderer renderer to draw on
+     * @param scene scene number used as the cache key
+     * @param signature hash of everything the scene drawing depends on
+     * @param drawScene draws the scenes full content e.g. background, text and buttons
+     */
+    void draw_scene(RenderBackend *renderer, int scene, size_t signature, const std::function<void()> &drawScene);
+    /**
+     * @brief destroy all cached scene textures
+     *
+     * call before the renderer is destroyed or recreated
+     */
+    void clear();
+    /**
+     * @brief combine a value into a scene signature
+     *
+     * EXAMPLE
+     * size_t signature = 0;
+     * MenuCompositor::hash_combine(signature, SCREEN_WIDTH);
+     */
+    template <typename T>
+    static void hash_combine(size_t &signature, const T &value)
+    {
+        signature ^= std::hash<T>()(value) + 0x9e3779b9 + (signature << 6) + (signature >> 2);
+    }
+};
@@ -0,0 +1,85 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief minimap with cached terrain and low rate entity markers
+ *
+ * Static terrain (e.g. background and obstacles) is drawn once into a small render target and only drawn again
+ * when the terrain revision or minimap size changes. Entity markers are collected at most every refreshInterval ms
+ * and kept as plain rects, so a frame is one texture copy plus one SDL_RenderFillRects() per marker color no
+ * matter how many entities are in the game world.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "Minimap.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern Minimap minimap;
+ * then in your globals.cpp as below, markers refresh at 10Hz
+ * Minimap minimap(100);
+ *
+ * 3. Draw the minimap, terrain is drawn at 0, 0 to area.w, area.h and markers are in the same coordinates
+ * minimap.draw(renderer, area, terrainRevision,
+ *     [&]() { renderer->copy(background1Texture, nullptr, nullptr); },
+ *     [&](std::vector<Minimap::Marker> &markers) { markers.push_back({{10, 10, 3, 3}, {255, 0, 0, 255}}); });
+ *
+ * 4. Destroy the terrain texture before destroying the renderer
+ * minimap.clear();
+ */
+class Minimap
+{
+public:
+    struct Marker
+    {
+        SDL_Rect rect{};   /**< marker position in minimap coordinates */
+        SDL_Color color{}; /**< marker fill color */
+    };
+
+private:
+    SDL_Texture *terrainTexture{};      /**< render target with the static terrain */
+    RenderBackend *renderer{};          /**< renderer terrainTexture was created with, for clear() */
+    int terrainWidth{};                 /**< terrain texture width, rebuilt when the minimap size changes */
+    int terrainHeight{};                /**< terrain texture height, rebuilt when the minimap size changes */
+    unsigned int terrainRevision{};     /**< revision the terrain was drawn with */
+    bool terrainDrawn{};                /**< false until the terrain texture has been drawn once */
+    std::vector<Marker> markers{};      /**< markers from the last refresh sorted by color */
+    std::vector<SDL_Rect> markerRects{}; /**< screen space rects of one color for SDL_RenderFillRects() */
+    Uint32 refreshInterval{};           /**< minimum ms between marker refreshes */
+    Uint32 lastRefresh{};               /**< SDL_GetTicks() of the last marker refresh */
+
+public:
+    /**
+     * @param refreshInterval minimum ms between marker refreshes e.g. 100 for 10Hz
+     */
+    Minimap(Uint32 refreshInterval);
+    ~Minimap();
+    /**
+     * @brief draw the cached terrain and markers, refreshing them if needed
+     *
+     * @param renderer renderer to draw on
+     * @param area minimap position and size on the window
+     * @param revision terrain revision, drawTerrain is called again when it changes
+     * @param drawTerrain draws the static terrain to 0, 0, area.w, area.h on the current render target
+     * @param collectMarkers fills the markers in minimap coordinates, called at most every refreshInterval ms
+     */
+    void draw(RenderBackend *renderer, const SDL_Rect &area, unsigned int revision, const std::function<void()> &drawTerrain,
+              const std::function<void(std::vector<Marker> &)> &collectMarkers);
+    /**
+     * @brief destroy the terrain texture and markers
+     *
+     * call before the renderer is destroyed or recreated
+     */
+    void clear();
+};
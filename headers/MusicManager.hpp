@@ -0,0 +1,158 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <SDL2/SDL_mixer.h>
+
+/**
+ * @brief background music that loads on a worker thread and fades between tracks
+ *
+ * Music files are opened with Mix_LoadMUS on a worker thread so a scene change never waits on a disk read or
+ * MP3 header scan. play() of the track already playing does nothing, e.g. levels that share a track keep
+ * playing it without reloading. Otherwise the current track fades out, the new one fades in once it's loaded
+ * and the replaced track is freed. SDL_mixer plays one music stream at a time so the tracks fade one after the
+ * other rather than overlapping. A track that play() asked for but was replaced by another play() before it
+ * started is freed as soon as it's loaded.
+ *
+ * preload() loads a track ahead of time so a later play() can start fading straight away, it's kept until it
+ * has been played and replaced or clear(). Every scene plays the same track for now so nothing calls preload(),
+ * scene setups can preload the next scenes track once levels have their own music.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "MusicManager.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern MusicManager musicManager;
+ * then in your globals.cpp as below, fading over 500ms
+ * MusicManager musicManager(500);
+ *
+ * 3. Start the worker thread after Mix_OpenAudio()
+ * musicManager.start();
+ *
+ * 4. Play a track e.g. when a scene is set up, optionally preloading the next scenes track
+ * musicManager.play("assets/sounds/music/Game Time - moodmode-studio.mp3");
+ * musicManager.preload("assets/sounds/music/Boss.mp3");
+ *
+ * 5. Pick up loaded tracks and advance fades once per frame
+ * musicManager.update();
+ *
+ * 6. Pause loading while the audio device is reopened, the worker can't call Mix_LoadMUS() on a closed mixer
+ * std::unique_lock<std::mutex> loadingPaused = musicManager.pause_loading();
+ *
+ * 7. Stop the worker and free every track before Mix_CloseAudio()
+ * musicManager.stop();
+ * musicManager.clear();
+ */
+class MusicManager
+{
+private:
+    struct Loaded
+    {
+        std::string path{};   /**< music file */
+        Mix_Music *music{};   /**< opened music, nullptr if it failed to load */
+        std::string error{};  /**< Mix_GetError() of a failed load, SDL errors are per thread so it's read by the loader */
+    };
+
+    std::thread worker{};                      /**< load thread */
+    std::mutex mutex{};                        /**< guards requests, loaded and stopping */
+    std::mutex loadMutex{};                    /**< held by the worker thread while it's in Mix_LoadMUS() */
+    std::condition_variable requestReady{};    /**< wakes the worker when a request is queued or on stop() */
+    std::deque<std::string> requests{};        /**< music files waiting for the worker */
+    std::deque<Loaded> loaded{};               /**< opened music waiting for update() */
+    bool stopping{};                           /**< set by stop() to end the worker thread */
+
+    std::unordered_map<std::string, Mix_Music *> tracks{}; /**< loaded tracks by path, main thread only */
+    std::unordered_set<std::string> loading{};             /**< paths requested and not yet picked up by update() */
+    std::unordered_set<std::string> preloaded{};           /**< preload() tracks kept until played */
+    std::string current{};                     /**< track playing or fading out */
+    std::string next{};                        /**< track to play once loaded and current has faded out */
+    bool fadingOut{};                          /**< current is fading out for next */
+    int fadeDuration{};                        /**< ms to fade out and fade in over */
+
+    void worker_loop();
+    /**
+     * @brief load a track on the worker thread unless it's loaded or loading
+     */
+    void request(const std::string &filePath);
+    /**
+     * @brief free a loaded track that isn't current, next or preloaded
+     */
+    void free_if_unused(const std::string &filePath);
+    /**
+     * @brief move tracks loaded by the worker into tracks and log the ones that failed
+     */
+    void collect_loaded();
+
+public:
+    /**
+     * @param fadeDuration ms to fade the old track out and the new one in over
+     */
+    MusicManager(int fadeDuration);
+    ~MusicManager();
+    /**
+     * @brief start the worker thread, without it preload() loads on the calling thread
+     */
+    void start();
+    /**
+     * @brief stop and join the worker thread, tracks it loaded are kept until clear()
+     */
+    void stop();
+    /**
+     * @brief wait for a load in progress to finish and keep the worker thread out of SDL_mixer until the lock is released
+     *
+     * EXAMPLE
+     * std::unique_lock<std::mutex> loadingPaused = musicManager.pause_loading();
+     * audioDevice.grow_buffer(SDL_GetTicks()); // closes and reopens the mixer
+     *
+     * @return lock held by the caller, loads carry on when it goes out of scope
+     */
+    std::unique_lock<std::mutex> pause_loading();
+    /**
+     * @brief load a track in the background without playing it
+     *
+     * @param filePath music file
+     */
+    void preload(const std::string &filePath);
+    /**
+     * @brief fade to a track, it starts when loaded and the current track has faded out
+     *
+     * @param filePath music file, nothing happens if it's already playing
+     */
+    void play(const std::string &filePath);
+    /**
+     * @brief pick up loaded tracks and start the next track once the fade out finishes, call once per frame
+     */
+    void update();
+    /**
+     * @brief start the current track again after the audio device was reopened, which halts the music
+     *
+     * @param paused pause it straight away, e.g. Mix_PausedMusic() from before the device was reopened
+     */
+    void restart(bool paused);
+    /**
+     * @brief halt the music and free every track
+     */
+    void clear();
+    /**
+     * @brief path of the track playing, empty if none
+     */
+    const std::string &get_current() const;
+    /**
+     * @brief tracks loaded
+     */
+    size_t get_track_count() const;
+};
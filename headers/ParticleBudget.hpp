@@ -0,0 +1,105 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief how important an effect's particles are when the particle budget is tight
+ */
+enum class ParticlePriority
+{
+    LOW,    /**< decoration e.g. splashes, thinned first and may only use half the cap */
+    NORMAL, /**< gameplay feedback e.g. explosions, thinned under frame pressure, may use most of the cap */
+    HIGH,   /**< never thinned, may use the whole cap */
+    COUNT
+};
+
+/**
+ * @brief global particle cap and spawn rate control under frame pressure
+ *
+ * Every burst asks the budget how many of its particles it may spawn. Lower priorities get less of the global
+ * cap so there is always room left for important effects. When the smoothed frame time goes over the frame
+ * budget the spawn rate of LOW and NORMAL particles is scaled down (LOW twice as hard) and recovers gradually
+ * once frames are back under budget, so heavy effects thin out instead of dropping frames. Fractions of a
+ * particle carry over to the next burst so small bursts are thinned evenly instead of rounding to nothing.
+ *
+ * Particles not spawned are counted per priority.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "ParticleBudget.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern ParticleBudget particleBudget;
+ * then in your globals.cpp as below, 4096 particles with a 20ms frame budget
+ * ParticleBudget particleBudget(4096, 20.0f);
+ *
+ * 3. Ask before spawning a burst, ParticleGenerator does this itself when constructed with the budget
+ * int allowed = particleBudget.request(ParticlePriority::NORMAL, 55, particles.get_count());
+ *
+ * 4. Report the frame time once per frame
+ * particleBudget.end_frame(frameTime);
+ *
+ * 5. Match the budget to the display, e.g. 20ms at 60Hz or 10ms at 120Hz, when the window opens or moves display
+ * particleBudget.set_frame_budget(1000.0f / refreshRate * 1.2f);
+ */
+class ParticleBudget
+{
+private:
+    size_t globalCap{};                                            /**< max live particles over every emitter */
+    float frameBudget{};                                           /**< ms per frame above which spawns are thinned */
+    float averageFrameTime{};                                      /**< smoothed ms per frame */
+    float spawnScale = 1.0f;                                       /**< 1 spawns everything, lower thins LOW and NORMAL spawns */
+    float carry[static_cast<int>(ParticlePriority::COUNT)]{};      /**< fraction of a particle owed to each priority */
+    unsigned long long dropped[static_cast<int>(ParticlePriority::COUNT)]{}; /**< particles not spawned per priority */
+
+public:
+    static constexpr float MIN_SPAWN_SCALE = 0.1f; /**< spawns are never thinned below 10% */
+
+    /**
+     * @param globalCap max live particles over every emitter
+     * @param frameBudget ms per frame above which spawns are thinned, e.g. 20 so vsync at 60Hz doesn't trigger it
+     */
+    ParticleBudget(size_t globalCap, float frameBudget);
+    ~ParticleBudget();
+    /**
+     * @brief get how many particles of a burst may be spawned, the rest are counted as dropped
+     *
+     * @param priority priority of the effect
+     * @param amount particles the effect wants to spawn
+     * @param liveCount particles alive right now
+     * @return particles to spawn, 0 to amount
+     */
+    int request(ParticlePriority priority, int amount, size_t liveCount);
+    /**
+     * @brief change the frame time spawns are thinned above e.g. from the display refresh rate
+     *
+     * @param frameBudget ms per frame
+     */
+    void set_frame_budget(float frameBudget);
+    /**
+     * @brief update the spawn rate from this frames time, call once per frame
+     *
+     * @param frameTime ms the frame took
+     */
+    void end_frame(float frameTime);
+    /**
+     * @brief current spawn scale, 1 when frames are within budget
+     */
+    float get_spawn_scale() const;
+    /**
+     * @brief particles not spawned for a priority
+     */
+    unsigned long long get_dropped_count(ParticlePriority priority) const;
+    /**
+     * @brief particles not spawned over every priority
+     */
+    unsigned long long get_dropped_count() const;
+};
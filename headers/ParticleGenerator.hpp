@@ -7,80 +7,250 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <iostream>
-#include <random>
-#include <string>
 #include <vector>
 #include <SDL2/SDL.h>
+#include "ParticleBudget.hpp"
+#include "RenderBackend.hpp"
+
+/**
+ * @brief preconfigured particle effects, indexes PARTICLE_PRESETS
+ */
+enum class ParticlePreset
+{
+    FIREWORKS, /**< random colours and transparency levels e.g. a firework */
+    WATER,     /**< blue and white e.g. water splashes */
+    FIRE,      /**< red and yellow e.g. candle flame */
+    COUNT
+};
+
+/**
+ * @brief colour range a particle colour is picked from, each channel uniformly between min and max
+ */
+struct ParticleColorRange
+{
+    SDL_Color min{};
+    SDL_Color max{};
+};
+
+/**
+ * @brief how an effect's particles are spawned and move
+ */
+struct EmitterPreset
+{
+    int minXVelocity{};                  /**< spawn x velocity range */
+    int maxXVelocity{};
+    int minYVelocity{};                  /**< spawn y velocity range, negative is up */
+    int maxYVelocity{};
+    float gravity{};                     /**< added to y velocity every update */
+    float lifetime{};                    /**< updates a particle lives */
+    ParticleColorRange palette[2]{};     /**< one range is picked at random per particle */
+    int paletteSize{};                   /**< ranges used in palette */
+    ParticlePriority priority{};         /**< how much of the ParticleBudget.hpp budget the effect gets */
+};
+
+/**
+ * @brief emitter presets by ParticlePreset, fixed at compile time
+ */
+constexpr EmitterPreset PARTICLE_PRESETS[static_cast<int>(ParticlePreset::COUNT)] = {
+    // FIREWORKS any colour and transparency
+    {-2, 2, -9, -5, 1.0f, 120.0f, {{{0, 0, 0, 0}, {255, 255, 255, 255}}}, 1, ParticlePriority::LOW},
+    // WATER blue particles with some white, decoration
+    {-2, 2, -9, -5, 1.0f, 120.0f, {{{0, 0, 0, 0}, {0, 0, 255, 255}}, {{255, 255, 255, 0}, {255, 255, 255, 255}}}, 2, ParticlePriority::LOW},
+    // FIRE red flame particles with some yellow, shows the player took damage
+    {-2, 2, -9, -5, 1.0f, 120.0f, {{{0, 0, 0, 0}, {255, 0, 0, 255}}, {{255, 255, 0, 128}, {255, 255, 0, 255}}}, 2, ParticlePriority::NORMAL},
+};
+
 /**
  * @brief Particle graphic render effect
  *
  * You can use this in any software e.g, game to draw particle effects such as treading on water,
  * lava from volcanoes, clouds, stars, or any image that you can represent with dots
  *
+ * Particles are stored in a fixed capacity pool as a structure of arrays, one array per field (positions,
+ * velocities, lifetimes, colors). Live particles are always the first get_count() entries, update() compacts
+ * the survivors to the front in the same sweep that moves them so nothing is allocated after construction.
+ * When the pool is full the OverflowPolicy decides whether new particles are dropped or overwrite live ones.
+ *
+ * update() processes 8 particles at a time with AVX2 or 4 with SSE2 when the compiler targets them
+ * (e.g. -mavx2), falling back to a scalar loop otherwise. update_scalar() always runs the scalar loop so tests
+ * can check both give the same particles.
+ *
+ * Particle positions are game world coordinates, they're drawn displaced by the camera like entities.
+ * render() draws every particle as a colored quad in one SDL_RenderGeometry call.
+ *
  * EXAMPLE
  *
- * 1. Create a vector to hold all the particles
- * std::vector<ParticleGenerator> particles{};
+ * 1. Create a pool to hold all the particles e.g. in your globals.cpp, up to 4096 particles
+ * ParticleGenerator particles(4096, ParticleGenerator::OverflowPolicy::OVERWRITE);
  *
- * 2. In a event e.g. Mouse handle click pass a preconfigured animation in the 3rd parameter
- * fireworks = random colours and transparency levels e.g. a firework
- * water = Water effects e.g. water splashes
- * fire = fire effects e.g. candle flame
+ * or limit bursts by priority and frame time with a ParticleBudget.hpp budget
+ * ParticleGenerator particles(4096, ParticleGenerator::OverflowPolicy::OVERWRITE, &particleBudget);
  *
- * int random = (rand() % 50) + 5;
- * for (int i = 0; i < random; ++i)
- * {
- *     particles.push_back(Particle(mouseX, mouseY, "fire"));
- * }
+ * 2. In a event e.g. Mouse handle click emit a burst of a preset effect, e.g. 5 to 54 fire particles
+ * particles.emit(ParticlePreset::FIRE, mouseX, mouseY, (rand() % 50) + 5);
  *
- * 3. In your rendering e.g. draw() draw the particles vector
- * ParticleGenerator::render_particles(particles, renderer);
+ * 3. Move particles and remove the dead ones once per update, culling those that leave the camera
+ * particles.update(cameraRect);
  *
- * 4. (Optional) Clear particles on exit depending on how you setup your camera/particles vector scope
- * ParticleGenerator::clear_particles(particles, SCREEN_HEIGHT);
+ * 4. In your rendering e.g. draw() draw the particles, once per split-screen view with that views camera
+ * particles.render(renderer, cameraRect);
+ *
+ * 5. (Optional) Remove every particle e.g. when a level ends
+ * particles.clear();
  *
  */
 class ParticleGenerator
 {
 public:
-    int xPos{};              /**< Particle x-axis position */
-    int yPos{};              /**< Particle y-axis position */
-    int vx{};                /**< Velocity of particle */
-    int vy{};                /**< Velocity of particle */
-    int r{};                 /**< Particle red color */
-    int g{};                 /**< Particle green color */
-    int b{};                 /**< Particle blue color */
-    int a{};                 /**< Particle alpha transparency level 255 is solid 0 is transparent */
-    std::string animation{}; /**< preconfigured particle colours textures you want to draw e.g. random, water, fire */
+    /**
+     * @brief what emit() does when the pool is full
+     */
+    enum class OverflowPolicy
+    {
+        DROP_NEW,  /**< the new particle isn't spawned */
+        OVERWRITE  /**< the new particle replaces a live one, cycling through the pool */
+    };
+
+private:
+    size_t capacity{};                      /**< max live particles */
+    size_t count{};                         /**< live particles, the first count entries of every array */
+    OverflowPolicy overflowPolicy{};        /**< what emit() does when count == capacity */
+    ParticleBudget *budget{};               /**< limits burst sizes, nullptr for no limit */
+    size_t overwriteIndex{};                /**< next particle OVERWRITE replaces */
+    unsigned long long overflowCount{};     /**< spawns dropped or overwritten because the pool was full */
+    std::vector<float> xPos{};              /**< Particle x-axis positions */
+    std::vector<float> yPos{};              /**< Particle y-axis positions */
+    std::vector<float> xVelocity{};         /**< Particle x-axis velocities */
+    std::vector<float> yVelocity{};         /**< Particle y-axis velocities */
+    std::vector<float> gravity{};           /**< added to y velocity every update */
+    std::vector<float> life{};              /**< updates left before the particle dies */
+    std::vector<SDL_Color> colors{};        /**< Particle colours, alpha 255 is solid 0 is transparent */
+    std::uint32_t randomState{};            /**< xorshift32 state, seeded once for the pool */
+    std::vector<SDL_Vertex> vertices{};     /**< 4 colored corners per particle, rebuilt by render() */
+    std::vector<int> indices{};             /**< 6 indices per particle, only extended when more particles are drawn */
+
+    /**
+     * @brief next xorshift32 random number, a few shifts and xors no syscalls
+     */
+    std::uint32_t next_random();
+    /**
+     * @brief random int between min and max inclusive
+     */
+    int random_range(int min, int max);
+
+    /**
+     * @brief index to write a new particle into
+     * @return particle index, or capacity if the particle should be dropped
+     */
+    size_t acquire_slot();
+    /**
+     * @brief copy every field of a particle to another index
+     */
+    void move(size_t from, size_t to);
+    /**
+     * @brief move the live particles of a block down to the end of the live particles so far
+     * @param first index of the blocks first particle
+     * @param width particles in the block
+     * @param deadMask bit n set if particle first + n died
+     * @param alive live particles kept so far
+     * @return live particles kept including this block
+     */
+    size_t compact(size_t first, size_t width, unsigned int deadMask, size_t alive);
+    /**
+     * @brief move, age and compact particles one at a time from first to the end of the live particles
+     * @param first index of the first particle to update
+     * @param alive live particles kept so far
+     * @return live particles kept including this range
+     */
+    size_t update_scalar_range(size_t first, size_t alive, float left, float right, float bottom);
+    /**
+     * @brief set the live count after a sweep and keep overwriteIndex inside it
+     */
+    void finish_update(size_t alive);
+
+public:
+    static constexpr float PARTICLE_SIZE = 3.0f; /**< particle width and height in pixels */
 
     /**
-     * @brief Particle default constructor
+     * @brief Particle pool constructor, allocates every array up front
+     * @param capacity max particles alive at once
+     * @param overflowPolicy what to do with new particles when capacity are alive
+     * @param budget budget every burst is checked against, nullptr to only be limited by capacity
      */
-    ParticleGenerator(int xPos, int yPos, std::string animation);
+    ParticleGenerator(size_t capacity, OverflowPolicy overflowPolicy, ParticleBudget *budget = nullptr);
 
     /**
-     * @brief Update particle position
-    */
-    void update();
+     * @brief spawn a burst of particles from a preset in one tight loop
+     * @param preset effect to spawn e.g. ParticlePreset::FIRE
+     * @param xPos spawn x position
+     * @param yPos spawn y position
+     * @param amount particles to spawn, thinned by the budget then limited by the OverflowPolicy when the pool fills up
+     */
+    void emit(ParticlePreset preset, int xPos, int yPos, int amount);
 
     /**
-     * @brief render the particles
-     * @param particles the particles vector
-     * @param renderer the reference to the renderer to draw on
+     * @brief move every particle, apply gravity and age it, removing dead particles in the same pass
+     *
+     * Particles die when their preset lifetime runs out or they leave the left, right or bottom of cullRect,
+     * particles above it are kept as gravity brings them back down
+     *
+     * @param cullRect game world area particles are kept in e.g. the camera
      */
-    static void render_particles(std::vector<ParticleGenerator> &particles, SDL_Renderer *renderer);
+    void update(const SDL_Rect &cullRect);
 
     /**
-     * @brief clear particles vector by removing if objects go out of camera view
+     * @brief update() without SIMD, one particle at a time
      *
-     * Clearing particles vector prematurely in draw will prevent full animation so in order
-     * to clear the particles vector periodically and before final cleanup call this functino
-     * after render_particles()
-     * Only renders what you can visualise by deleting all the pixels that move out of the screens width
+     * Same results as update(), for testing the SIMD path against
      *
-     * @param particles the global vector holding all particles
-     * @param SCREEN_HEIGHT to be changed to camera view for rending only whats in scren
+     * @param cullRect game world area particles are kept in e.g. the camera
+     */
+    void update_scalar(const SDL_Rect &cullRect);
+
+    /**
+     * @brief draw every particle with one SDL_RenderGeometry call, or one fill each if geometry isn't supported
+     * @param renderer the renderer to draw on
+     * @param camera game world position of the window, subtracted from particle positions
+     */
+    void render(RenderBackend *renderer, const SDL_Rect &camera);
+
+    /**
+     * @brief remove every particle, capacity stays allocated
+     */
+    void clear();
+
+    /**
+     * @brief x position of a live particle
+     * @param index 0 to get_count() - 1
+     */
+    float get_x(size_t index) const;
+
+    /**
+     * @brief y position of a live particle
+     * @param index 0 to get_count() - 1
+     */
+    float get_y(size_t index) const;
+
+    /**
+     * @brief updates left before a live particle dies
+     * @param index 0 to get_count() - 1
+     */
+    float get_life(size_t index) const;
+
+    /**
+     * @brief live particles
+     */
+    size_t get_count() const;
+
+    /**
+     * @brief max live particles
+     */
+    size_t get_capacity() const;
+
+    /**
+     * @brief spawns dropped or overwritten because the pool was full
      */
-    static void clear_particles(std::vector<ParticleGenerator> &particles, int SCREEN_HEIGHT);
+    unsigned long long get_overflow_count() const;
 };
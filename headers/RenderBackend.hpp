@@ -0,0 +1,251 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <string>
+#include <SDL2/SDL.h>
+
+/**
+ * @brief renderer interface every draw call, texture and render state change goes through
+ *
+ * Drawing code calls the global RenderBackend *renderer instead of SDL_Render*() functions, so the same game
+ * loop can draw to a window (WindowRenderer, or RenderThread from its own thread) or record draws without
+ * rasterising anything (HeadlessRenderer).
+ * Textures are still SDL_Texture pointers but only the backend that created them may use them, e.g. the
+ * headless backends textures are handles SDL never sees.
+ *
+ * Every draw call is counted under the current DrawCategory, set with set_category() or a ScopedCategory
+ * around e.g. the HUD or the menu buttons. present() ends the frame, get_draw_calls() reads the last frames
+ * counts and get_total_draw_calls() every frame since the backend was created.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "RenderBackend.hpp"
+ *
+ * 2. Point the global renderer at a backend once it's created e.g. in start_SDL()
+ * renderThread.start(window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+ * renderer = &renderThread;
+ *
+ * 3. Draw through it, counted under a category until the scope ends
+ * RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::HUD);
+ * renderer->set_draw_color(255, 0, 0, 255);
+ * renderer->fill_rect(&healthBarRect);
+ * renderer->copy(heartTexture, nullptr, &heartRect);
+ *
+ * 4. End the frame
+ * renderer->present();
+ *
+ * 5. Read the last frames draw calls e.g. in a debug overlay or test
+ * renderer->get_draw_calls(RenderBackend::DrawCategory::TEXT);
+ */
+class RenderBackend
+{
+public:
+    /**
+     * @brief what a draw call was for, each is counted separately
+     */
+    enum class DrawCategory
+    {
+        OTHER,         /**< clears, backgrounds and anything not in a category below */
+        MENUS,         /**< buttons, dropdowns and composed menu scenes */
+        TEXT,          /**< text and glyph quads, including text drawn by the categories around it */
+        HUD,           /**< health, score, timer and minimap */
+        SPRITES,       /**< entity sprites submitted by the RenderQueue */
+        STATIC_CHUNKS, /**< baked static layer chunks */
+        PARTICLES,     /**< particle batches */
+        VIDEO,         /**< video frames */
+        COUNT          /**< number of categories, not a category */
+    };
+
+    /**
+     * @brief set a draw category until the end of the scope, then restore the previous one
+     */
+    class ScopedCategory
+    {
+    private:
+        RenderBackend *backend{};  /**< backend the category was set on */
+        DrawCategory previous{};   /**< category to restore */
+
+    public:
+        ScopedCategory(RenderBackend *backend, DrawCategory category) : backend(backend), previous(backend->set_category(category)) {}
+        ~ScopedCategory() { backend->set_category(previous); }
+        ScopedCategory(const ScopedCategory &) = delete;
+        ScopedCategory &operator=(const ScopedCategory &) = delete;
+    };
+
+private:
+    static constexpr int CATEGORY_COUNT = static_cast<int>(DrawCategory::COUNT);
+
+    DrawCategory category{};                                  /**< category new draw calls are counted under */
+    unsigned long long drawCalls[CATEGORY_COUNT]{};           /**< draw calls this frame by category */
+    unsigned long long lastFrameDrawCalls[CATEGORY_COUNT]{};  /**< draw calls of the last presented frame */
+    unsigned long long totalDrawCalls[CATEGORY_COUNT]{};      /**< draw calls since reset_statistics() */
+    unsigned long long frames{};                              /**< frames presented since reset_statistics() */
+    unsigned int generation{};                                /**< bumped every time the backend is (re)created */
+
+protected:
+    /**
+     * @brief count a draw call under the current category
+     */
+    void count_draw_call();
+    /**
+     * @brief forget every count, call when the backend is created
+     */
+    void reset_statistics();
+    /**
+     * @brief mark textures created before now as freed e.g. after the backend was recreated
+     */
+    void next_generation();
+
+    virtual int draw_clear() = 0;
+    virtual int draw_fill_rects(const SDL_Rect *rects, int count) = 0;
+    virtual int draw_outline_rect(const SDL_Rect *rect) = 0;
+    virtual int draw_line_segment(int x1, int y1, int x2, int y2) = 0;
+    virtual int draw_copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst) = 0;
+    virtual int draw_geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount) = 0;
+    virtual void present_frame() = 0;
+
+public:
+    RenderBackend() = default;
+    virtual ~RenderBackend() = default;
+    RenderBackend(const RenderBackend &) = delete;
+    RenderBackend &operator=(const RenderBackend &) = delete;
+
+    /**
+     * @brief count draw calls from now on under a category
+     *
+     * @param category e.g. DrawCategory::HUD
+     * @return the category that was set, to restore afterwards
+     */
+    DrawCategory set_category(DrawCategory category);
+    /**
+     * @brief category draw calls are counted under now
+     */
+    DrawCategory get_category() const;
+
+    /**
+     * @brief fill the render target with the draw colour, SDL_RenderClear()
+     */
+    int clear();
+    /**
+     * @brief fill a rect with the draw colour, SDL_RenderFillRect()
+     *
+     * @param rect rect to fill, nullptr fills the whole target
+     */
+    int fill_rect(const SDL_Rect *rect);
+    /**
+     * @brief fill rects with the draw colour in one draw call, SDL_RenderFillRects()
+     */
+    int fill_rects(const SDL_Rect *rects, int count);
+    /**
+     * @brief outline a rect with the draw colour, SDL_RenderDrawRect()
+     */
+    int draw_rect(const SDL_Rect *rect);
+    /**
+     * @brief draw a line with the draw colour, SDL_RenderDrawLine()
+     */
+    int draw_line(int x1, int y1, int x2, int y2);
+    /**
+     * @brief copy part of a texture to the target, SDL_RenderCopy()
+     *
+     * @param texture texture created by this backend
+     * @param src part of the texture, nullptr for all of it
+     * @param dst where on the target, nullptr for all of it
+     */
+    int copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst);
+    /**
+     * @brief draw textured triangles in one draw call, SDL_RenderGeometry()
+     */
+    int geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount);
+    /**
+     * @brief show the frame and end it, SDL_RenderPresent()
+     */
+    void present();
+
+    /**
+     * @brief colour used by clear(), fill and outline draws, SDL_SetRenderDrawColor()
+     */
+    virtual int set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a) = 0;
+    virtual int get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a) = 0;
+    /**
+     * @brief blend mode of fill and outline draws, SDL_SetRenderDrawBlendMode()
+     */
+    virtual int set_draw_blend_mode(SDL_BlendMode blendMode) = 0;
+    virtual int get_draw_blend_mode(SDL_BlendMode *blendMode) = 0;
+    /**
+     * @brief draw into a SDL_TEXTUREACCESS_TARGET texture, nullptr for the window, SDL_SetRenderTarget()
+     */
+    virtual int set_target(SDL_Texture *texture) = 0;
+    virtual SDL_Texture *get_target() = 0;
+    /**
+     * @brief limit and offset draws to a rect of the target, nullptr for all of it, SDL_RenderSetViewport()
+     */
+    virtual int set_viewport(const SDL_Rect *rect) = 0;
+    virtual void get_viewport(SDL_Rect *rect) = 0;
+    /**
+     * @brief only change pixels inside a rect of the viewport, nullptr to disable, SDL_RenderSetClipRect()
+     */
+    virtual int set_clip_rect(const SDL_Rect *rect) = 0;
+    /**
+     * @brief size of the window or offscreen frame in pixels, SDL_GetRendererOutputSize()
+     */
+    virtual int get_output_size(int *w, int *h) = 0;
+
+    /**
+     * @brief SDL_CreateTexture()
+     */
+    virtual SDL_Texture *create_texture(Uint32 format, int access, int w, int h) = 0;
+    /**
+     * @brief SDL_CreateTextureFromSurface(), the surface is still the callers to free
+     */
+    virtual SDL_Texture *create_texture_from_surface(SDL_Surface *surface) = 0;
+    /**
+     * @brief decode an image file and create a texture of it, IMG_LoadTexture()
+     *
+     * @param filePath image file e.g. "assets/sprites/buttons/Button.png"
+     * @return texture, nullptr if the file couldn't be loaded
+     */
+    SDL_Texture *load_texture(const std::string &filePath);
+    /**
+     * @brief SDL_UpdateTexture()
+     */
+    virtual int update_texture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch) = 0;
+    /**
+     * @brief SDL_UpdateYUVTexture()
+     */
+    virtual int update_yuv_texture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *yPlane, int yPitch, const Uint8 *uPlane, int uPitch, const Uint8 *vPlane, int vPitch) = 0;
+    /**
+     * @brief SDL_SetTextureBlendMode()
+     */
+    virtual int set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode) = 0;
+    /**
+     * @brief SDL_DestroyTexture(), nullptr does nothing
+     */
+    virtual void destroy_texture(SDL_Texture *texture) = 0;
+
+    /**
+     * @brief draw calls of a category in the last presented frame
+     */
+    unsigned long long get_draw_calls(DrawCategory category) const;
+    /**
+     * @brief draw calls of a category since the backend was created
+     */
+    unsigned long long get_total_draw_calls(DrawCategory category) const;
+    /**
+     * @brief frames presented since the backend was created
+     */
+    unsigned long long get_frame_count() const;
+    /**
+     * @brief changes when the backend is recreated and every texture it made was freed with it
+     *
+     * e.g. a button keeps the generation its texture was created in and forgets the texture when it differs
+     */
+    unsigned int get_generation() const;
+};
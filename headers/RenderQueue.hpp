@@ -0,0 +1,119 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief sorted queue of draw commands submitted once per frame
+ *
+ * Instead of calling SDL_RenderCopy in whatever order objects are stored, texture copies are queued
+ * with a 64 bit sort key and submitted together. The key packs, most significant first:
+ *
+ * | layer 8 bits | zPos 16 bits | texture id 24 bits | blend mode 8 bits | unused 8 bits |
+ *
+ * so commands draw back to front by layer then zPos, and within the same layer and zPos commands sharing a
+ * texture or blend mode end up next to each other, texture and blend switches only happen when the key
+ * changes. Keys are sorted with a stable LSD radix sort over the key bytes, no comparisons and commands with
+ * equal keys keep the order they were queued in. Bytes every key shares are skipped.
+ *
+ * Only the gameplay entity sprites go through the queue, particles are already one SDL_RenderGeometry batch.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "RenderQueue.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern RenderQueue renderQueue;
+ * then in your globals.cpp as below
+ * RenderQueue renderQueue{};
+ *
+ * 3. Queue draws in any order
+ * renderQueue.copy(RenderQueue::LAYER_ENTITIES, e->get_z_pos(), texture, rect);
+ *
+ * 4. Sort and draw everything queued
+ * renderQueue.submit(renderer);
+ *
+ * 5. Forget texture ids before textures are destroyed e.g. renderer recreation
+ * renderQueue.clear();
+ */
+class RenderQueue
+{
+public:
+    static constexpr Uint8 LAYER_ENTITIES = 1;  /**< game world sprites */
+
+private:
+    struct Command
+    {
+        SDL_Texture *texture{}; /**< texture to copy */
+        SDL_Rect rect{};        /**< screen rect */
+        SDL_BlendMode blend{};  /**< texture blend mode */
+    };
+    struct SortEntry
+    {
+        std::uint64_t key{};    /**< sort key */
+        std::uint32_t command{}; /**< index into commands */
+    };
+
+    std::vector<Command> commands{};         /**< commands queued this frame */
+    std::vector<SortEntry> entries{};        /**< keys of commands, sorted by submit() */
+    std::vector<SortEntry> scratch{};        /**< radix sort buffer */
+    std::unordered_map<SDL_Texture *, std::uint32_t> textureIds{}; /**< small ids for the sort key */
+    int lastCommandCount{};                  /**< commands in the last submit() */
+    int lastStateChanges{};                  /**< texture and blend switches in the last submit() */
+
+    std::uint32_t get_texture_id(SDL_Texture *texture);
+    void radix_sort();
+
+public:
+    RenderQueue();
+    ~RenderQueue();
+    /**
+     * @brief build a sort key
+     *
+     * @param layer draw layer, higher layers draw on top
+     * @param zPos depth within the layer, higher draws on top, clamped to a 16 bit range
+     * @param textureId texture id
+     * @param blend blend mode
+     * @return 64 bit key, ascending keys draw first
+     */
+    static std::uint64_t make_key(Uint8 layer, int zPos, std::uint32_t textureId, SDL_BlendMode blend);
+    /**
+     * @brief queue a texture copy
+     *
+     * @param layer draw layer e.g. LAYER_ENTITIES
+     * @param zPos depth within the layer e.g. Entity::get_z_pos()
+     * @param texture texture to copy, nothing is queued for nullptr
+     * @param rect screen rect to copy to
+     * @param blend blend mode set on the texture before copying
+     */
+    void copy(Uint8 layer, int zPos, SDL_Texture *texture, const SDL_Rect &rect, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+    /**
+     * @brief sort and draw every queued command then empty the queue, vectors keep their capacity
+     *
+     * @param renderer renderer to draw with
+     */
+    void submit(RenderBackend *renderer);
+    /**
+     * @brief drop queued commands and texture ids
+     */
+    void clear();
+    /**
+     * @brief commands drawn by the last submit()
+     */
+    int get_last_command_count() const;
+    /**
+     * @brief texture and blend mode switches in the last submit()
+     */
+    int get_last_state_changes() const;
+};
@@ -0,0 +1,120 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <SDL2/SDL.h>
+
+/**
+ * @brief triple buffered render snapshots passed from the simulation to draw()
+ *
+ * The simulation writes what should be drawn this tick (textures and screen rects, already culled and
+ * animated) into a snapshot and publishes it. draw() acquires the newest published snapshot and draws
+ * only from it, never reading entities, so the two sides can run at different rates or on different threads.
+ *
+ * draw() records the sprites together with the text, menus and HUD into a RenderThread.hpp frame, the
+ * immutable list of every command of that frame, which the render thread replays and presents while the
+ * simulation runs the next tick. Unlike snapshots frames are never dropped as they carry texture updates.
+ *
+ * Three snapshots are rotated with one atomic swap each way: the writer always has its own snapshot, the
+ * reader always has its own snapshot, and the third is the newest published one. Neither side waits on the
+ * other, a snapshot published while the reader is busy replaces the older unread one (counted as dropped).
+ *
+ * A snapshot has one view per screen region (one for a single player, one per local player for split-screen),
+ * all views share one sprite list and each view draws its own range of it.
+ *
+ * Snapshots hold texture pointers, call clear() before those textures are destroyed e.g. renderer recreation.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "RenderSnapshots.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern RenderSnapshots renderSnapshots;
+ * then in your globals.cpp as below
+ * RenderSnapshots renderSnapshots{};
+ *
+ * 3. Simulation side, once per tick
+ * RenderSnapshots::Snapshot &snapshot = renderSnapshots.begin_write();
+ * snapshot.views.push_back({screenRect, cameraRect, snapshot.sprites.size()});
+ * snapshot.sprites.push_back({texture, viewRect});
+ * snapshot.views.back().spriteCount = 1;
+ * renderSnapshots.publish();
+ *
+ * 4. Render side, once per frame
+ * const RenderSnapshots::Snapshot &snapshot = renderSnapshots.acquire();
+ * for (const RenderSnapshots::View &view : snapshot.views)
+ *     for (size_t i = view.firstSprite; i < view.firstSprite + view.spriteCount; i++)
+ *         renderer->copy(snapshot.sprites[i].texture, nullptr, &snapshot.sprites[i].rect);
+ */
+class RenderSnapshots
+{
+public:
+    struct Sprite
+    {
+        SDL_Texture *texture{}; /**< texture to draw, owned by AnimationClips or the TextureLoader */
+        SDL_Rect rect{};        /**< position and size within its view, camera already applied */
+        int zPos{};             /**< entity depth for RenderQueue.hpp draw ordering */
+    };
+    struct View
+    {
+        SDL_Rect screen{};      /**< window region the view is drawn in e.g. a split-screen quarter */
+        SDL_Rect camera{};      /**< game world area shown, same size as screen */
+        size_t firstSprite{};   /**< index of the views first sprite in sprites */
+        size_t spriteCount{};   /**< sprites drawn in this view */
+    };
+    struct Snapshot
+    {
+        std::vector<Sprite> sprites{}; /**< sprites of every view, each views range in draw order */
+        std::vector<View> views{};     /**< screen regions to draw, one unless split-screen */
+        int entitiesTotal{};           /**< entities in the scene, for the debug overlay */
+        int entitiesDrawn{};           /**< entities with a sprite in any view, counted once when in several views */
+        unsigned int tick{};           /**< publish count when written, 0 for a snapshot never published */
+    };
+
+private:
+    static constexpr int INDEX_MASK = 0x3; /**< low bits of readyIndex hold the buffer index */
+    static constexpr int FRESH = 0x4;      /**< set in readyIndex when it holds a snapshot the reader hasn't taken */
+
+    Snapshot buffers[3]{};            /**< rotated between writer, reader and ready */
+    int writeIndex = 0;               /**< writer's snapshot, writer thread only */
+    int readIndex = 1;                /**< reader's snapshot, reader thread only */
+    std::atomic<int> readyIndex{2};   /**< newest published snapshot index plus the FRESH flag */
+    unsigned int published{};         /**< snapshots published, writer thread only */
+    std::atomic<unsigned int> dropped{}; /**< published snapshots replaced before the reader took them */
+
+public:
+    RenderSnapshots();
+    ~RenderSnapshots();
+    /**
+     * @brief get the writer's snapshot emptied for this tick, sprite capacity is kept so it doesn't allocate
+     *
+     * @return snapshot to fill in before publish()
+     */
+    Snapshot &begin_write();
+    /**
+     * @brief make the written snapshot the newest one for acquire()
+     */
+    void publish();
+    /**
+     * @brief get the newest published snapshot, or the same one again if nothing new was published
+     *
+     * @return snapshot that stays valid and unchanged until the next acquire()
+     */
+    const Snapshot &acquire();
+    /**
+     * @brief empty every snapshot, only call while neither side is using them
+     */
+    void clear();
+    /**
+     * @brief number of published snapshots the reader never drew
+     */
+    unsigned int get_dropped_count() const;
+};
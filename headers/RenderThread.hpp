@@ -0,0 +1,279 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+#include "WindowRenderer.hpp"
+
+/**
+ * @brief RenderBackend that draws to a window from its own thread
+ *
+ * The SDL_Renderer is created, drawn with and presented on a dedicated render thread, the main thread keeps the
+ * window and its events. Draws on the main thread are recorded into a Frame, an immutable list of every command
+ * of that frame (sprites, text, menus, HUD, texture creates, updates and destroys), and present() hands it to the
+ * render thread which replays it and waits for vsync while the main thread handles events and simulates the next
+ * tick.
+ *
+ * Frames are triple buffered: one is being recorded, up to two are queued or being replayed. Frames are never
+ * dropped as they carry texture commands, present() waits instead when the render thread is two frames behind.
+ *
+ * Textures are handles made on the main thread, creating one records a create command the render thread resolves
+ * when it gets there, so a text cache or glyph miss mid draw never waits on the render thread. Surfaces and pixels
+ * are copied into the frame so the caller can free or reuse them. Draw state (colour, blend mode, target, viewport)
+ * is tracked on the main thread and the output size is cached after every present so getters never wait.
+ *
+ * SDL_CreateRenderer() adds an event watch that updates the renderer on whichever thread pumps window events, so
+ * while started window events are held back by an event filter and forward_window_events() pushes them again from
+ * the render thread, where they're queued for handle() as usual. Only use it where is_supported() says SDL allows a
+ * renderer off the main thread, otherwise draw with a WindowRenderer on the main thread.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "RenderThread.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern RenderThread renderThread;
+ * then in your globals.cpp as below
+ * RenderThread renderThread{};
+ *
+ * 3. Start the render thread for a window created on the main thread and draw through it like any RenderBackend
+ * if (RenderThread::is_supported() && renderThread.start(window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC))
+ * {
+ *     renderer = &renderThread;
+ * }
+ *
+ * 4. Wake a waiting event loop when a window event is held back, and forward them once per tick before handle()
+ * renderThread.set_window_event_callback(wake_event_loop);
+ * renderThread.forward_window_events();
+ *
+ * 5. Recreate the SDL_Renderer e.g. to toggle vsync, queued frames are drawn first and every texture is freed
+ * renderThread.recreate(SDL_RENDERER_ACCELERATED);
+ *
+ * 6. Stop on exit before the window is destroyed
+ * renderThread.stop();
+ */
+class RenderThread : public RenderBackend
+{
+private:
+    enum class CommandType
+    {
+        CLEAR,
+        FILL_RECTS,
+        DRAW_RECT,
+        DRAW_LINE,
+        COPY,
+        GEOMETRY,
+        SET_DRAW_COLOR,
+        SET_DRAW_BLEND_MODE,
+        SET_TARGET,
+        SET_VIEWPORT,
+        SET_CLIP_RECT,
+        CREATE_TEXTURE,
+        CREATE_TEXTURE_FROM_SURFACE,
+        UPDATE_TEXTURE,
+        UPDATE_YUV_TEXTURE,
+        SET_TEXTURE_BLEND_MODE,
+        DESTROY_TEXTURE
+    };
+
+    /**
+     * @brief texture handle given out as the SDL_Texture pointer, resolved by the render thread
+     */
+    struct Texture
+    {
+        SDL_Texture *texture{};       /**< real texture, render thread only, nullptr until created */
+        int w{};                      /**< width in pixels, set when the handle is made */
+        int h{};                      /**< height in pixels, set when the handle is made */
+    };
+
+    struct Command
+    {
+        CommandType type{};
+        SDL_Texture *texture{};       /**< handle drawn, created, updated, targeted or destroyed */
+        SDL_Rect rect{};              /**< destination, outline, viewport, clip or update rect, a line's x1, y1, x2, y2 */
+        SDL_Rect src{};               /**< part of the texture copied */
+        bool hasRect{};               /**< false passes nullptr for rect */
+        bool hasSrc{};                /**< false passes nullptr for src */
+        SDL_Color color{};            /**< SET_DRAW_COLOR */
+        SDL_BlendMode blendMode{};    /**< SET_DRAW_BLEND_MODE and SET_TEXTURE_BLEND_MODE */
+        Uint32 format{};              /**< CREATE_TEXTURE pixel format */
+        int access{};                 /**< CREATE_TEXTURE SDL_TEXTUREACCESS_* */
+        SDL_Surface *surface{};       /**< CREATE_TEXTURE_FROM_SURFACE copy, freed by the render thread */
+        size_t first{};               /**< first rect, vertex or pixel byte of the command in its Frame */
+        size_t count{};               /**< number of rects, vertices or pixel bytes */
+        size_t firstIndex{};          /**< GEOMETRY first index in its Frame */
+        int indexCount{};             /**< GEOMETRY indices, 0 to draw the vertices without */
+        int pitch[3]{};               /**< bytes per row of the pixels, the Y, U and V planes for UPDATE_YUV_TEXTURE */
+    };
+
+    /**
+     * @brief every command of one frame, written on the main thread and only read by the render thread once queued
+     */
+    struct Frame
+    {
+        std::vector<Command> commands{};
+        std::vector<SDL_Rect> rects{};         /**< FILL_RECTS rects */
+        std::vector<SDL_Vertex> vertices{};    /**< GEOMETRY vertices */
+        std::vector<int> indices{};            /**< GEOMETRY indices */
+        std::vector<Uint8> pixels{};           /**< copies of the pixels of texture updates */
+        bool present{};                        /**< present after replaying, false for a flush() between frames */
+    };
+
+    static constexpr int FRAME_COUNT = 3;
+
+    WindowRenderer windowRenderer{};           /**< the windows SDL_Renderer, render thread only */
+    SDL_Window *window{};                      /**< window given to start() */
+    std::thread thread{};                      /**< render thread, joinable while started */
+    std::mutex mutex{};                        /**< guards submitted, replayed, task, stopping and windowEvents */
+    std::condition_variable workReady{};       /**< wakes the render thread when a frame or task is queued or on stop() */
+    std::condition_variable workDone{};        /**< wakes the main thread when a frame was replayed or a task ran */
+    Frame frames[FRAME_COUNT]{};               /**< frame submitted % FRAME_COUNT is recorded into */
+    unsigned long long submitted{};            /**< frames handed to the render thread, written by the main thread */
+    unsigned long long replayed{};             /**< frames the render thread finished, written by the render thread */
+    const std::function<void()> *task{};       /**< function the main thread waits on the render thread to run */
+    bool stopping{};                           /**< set by stop() to end the render thread once the queue is empty */
+    std::atomic<int> outputWidth{};            /**< output size after the last present, for get_output_size() */
+    std::atomic<int> outputHeight{};
+    bool targetsSupported{};                   /**< SDL_RenderTargetSupported() of the current renderer */
+    std::vector<SDL_Event> windowEvents{};     /**< window events held back until forward_window_events() */
+    std::function<void()> onWindowEvent{};     /**< called when a window event is held back e.g. to wake the event loop */
+
+    // draw state as recorded so far, main thread only
+    std::unordered_set<Texture *> textures{};  /**< live texture handles */
+    SDL_Texture *target{};                     /**< set_target() */
+    SDL_Rect viewport{};                       /**< set_viewport(), empty for the whole target */
+    SDL_Color drawColor{};                     /**< set_draw_color() */
+    SDL_BlendMode drawBlendMode{};             /**< set_draw_blend_mode() */
+
+    void thread_loop();
+    void replay(Frame &frame);
+    void update_output_size();
+    /**
+     * @brief create the SDL_Renderer on the render thread, destroying any previous one
+     */
+    bool create_renderer(Uint32 flags);
+    /**
+     * @brief run a function on the render thread between frames and wait for it, main thread only
+     */
+    void run_on_render_thread(const std::function<void()> &function);
+    /**
+     * @brief queue the frame being recorded, waits while the render thread is FRAME_COUNT - 1 frames behind
+     */
+    void submit(bool present);
+    /**
+     * @brief queue any commands recorded since the last present and wait until every queued frame was replayed
+     */
+    void flush();
+    /**
+     * @brief free every handle after the renderer that resolved them was destroyed, the render thread is idle
+     */
+    void free_textures();
+    void reset_draw_state();
+    /**
+     * @brief frame being recorded, nullptr and nothing is recorded while the render thread isn't running
+     */
+    Frame *recording();
+    Command &record(Frame &frame, CommandType type, SDL_Texture *texture, const SDL_Rect *rect);
+    /**
+     * @brief handle of a live texture of this backend, nullptr and reported if it isn't one
+     */
+    Texture *find_texture(SDL_Texture *texture, const char *caller) const;
+    /**
+     * @brief real texture of a handle, render thread only
+     */
+    static SDL_Texture *resolve(SDL_Texture *texture);
+    /**
+     * @brief SDL event filter holding back window events pumped on any thread but the render thread
+     */
+    static int filter_window_events(void *userdata, SDL_Event *event);
+
+protected:
+    int draw_clear() override;
+    int draw_fill_rects(const SDL_Rect *rects, int count) override;
+    int draw_outline_rect(const SDL_Rect *rect) override;
+    int draw_line_segment(int x1, int y1, int x2, int y2) override;
+    int draw_copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst) override;
+    int draw_geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount) override;
+    void present_frame() override;
+
+public:
+    RenderThread();
+    ~RenderThread();
+    /**
+     * @brief whether SDL supports a renderer created and used off the main thread with the current video driver
+     *
+     * Windows and X11 do, Cocoa only allows it on the main thread and other drivers aren't known to work
+     */
+    static bool is_supported();
+    /**
+     * @brief start the render thread and create the SDL_Renderer on it
+     *
+     * @param window window created on the main thread
+     * @param flags SDL_CreateRenderer() flags e.g. SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
+     * @return true if the renderer was created, the thread is stopped again if it wasn't
+     */
+    bool start(SDL_Window *window, Uint32 flags);
+    /**
+     * @brief replace the SDL_Renderer after the queued frames were drawn, every texture is freed with the old one
+     *
+     * @param flags SDL_CreateRenderer() flags
+     * @return true if the new renderer was created
+     */
+    bool recreate(Uint32 flags);
+    /**
+     * @brief draw the queued frames, destroy the SDL_Renderer and every texture on the render thread and join it
+     */
+    void stop();
+    /**
+     * @brief push the window events held back since the last call from the render thread, main thread only
+     *
+     * SDL's renderer event watch sees them on the thread using the renderer and they're queued for handle()
+     */
+    void forward_window_events();
+    /**
+     * @brief set a function called on the pumping thread when a window event is held back
+     *
+     * @param callback e.g. wake_event_loop so a waiting event loop forwards it
+     */
+    void set_window_event_callback(std::function<void()> callback);
+
+    int set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a) override;
+    int get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a) override;
+    int set_draw_blend_mode(SDL_BlendMode blendMode) override;
+    int get_draw_blend_mode(SDL_BlendMode *blendMode) override;
+    int set_target(SDL_Texture *texture) override;
+    SDL_Texture *get_target() override;
+    int set_viewport(const SDL_Rect *rect) override;
+    void get_viewport(SDL_Rect *rect) override;
+    int set_clip_rect(const SDL_Rect *rect) override;
+    int get_output_size(int *w, int *h) override;
+
+    /**
+     * @brief make a texture handle straight away, the texture is created when the render thread reaches it
+     *
+     * @return handle, nullptr for SDL_TEXTUREACCESS_TARGET when the renderer has no render targets
+     */
+    SDL_Texture *create_texture(Uint32 format, int access, int w, int h) override;
+    /**
+     * @brief make a texture handle of a copy of the surface, the surface is still the callers to free
+     */
+    SDL_Texture *create_texture_from_surface(SDL_Surface *surface) override;
+    int update_texture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch) override;
+    int update_yuv_texture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *yPlane, int yPitch, const Uint8 *uPlane, int uPitch, const Uint8 *vPlane, int vPitch) override;
+    int set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode) override;
+    void destroy_texture(SDL_Texture *texture) override;
+};
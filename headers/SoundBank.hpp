@@ -0,0 +1,81 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <SDL2/SDL_mixer.h>
+
+/**
+ * @brief shared reference counted sound effects keyed by file path
+ *
+ * Each sound file is decoded once with Mix_LoadWAV no matter how many entities or globals use it, e.g. 100 Trees
+ * with the same collision sound share one Mix_Chunk. Every acquire() of a path must be matched with a release(),
+ * the chunk is freed when the last user releases it. A file that fails to load is remembered as nullptr so the
+ * error is reported once instead of once per entity.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "SoundBank.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern SoundBank soundBank;
+ * then in your globals.cpp as below
+ * SoundBank soundBank{};
+ *
+ * 3. Get a sound after Mix_OpenAudio(), loading it only if no one else uses it yet
+ * Mix_Chunk *bumpSound = soundBank.acquire("assets/sounds/sound-effects/wavs/bump 7 - Pixabay.wav");
+ * Mix_PlayChannel(-1, bumpSound, 0);
+ *
+ * 4. Release it when done e.g. in a destructor
+ * soundBank.release("assets/sounds/sound-effects/wavs/bump 7 - Pixabay.wav");
+ *
+ * 5. Free every sound before Mix_CloseAudio()
+ * soundBank.clear();
+ */
+class SoundBank
+{
+private:
+    struct Sound
+    {
+        Mix_Chunk *chunk{}; /**< decoded sound, nullptr if the file failed to load */
+        int references{};   /**< acquire() calls not yet released */
+    };
+    std::unordered_map<std::string, Sound> sounds{}; /**< sound by file path */
+    unsigned long long loadCount{};                  /**< Mix_LoadWAV calls made */
+
+public:
+    SoundBank();
+    ~SoundBank();
+    /**
+     * @brief get a sound, loading it only the first time the path is acquired
+     *
+     * @param filePath path of the .wav file
+     * @return the shared sound, nullptr if it failed to load
+     */
+    Mix_Chunk *acquire(const std::string &filePath);
+    /**
+     * @brief give back a sound from acquire(), freeing it when no one else uses it
+     *
+     * @param filePath the path passed to acquire()
+     */
+    void release(const std::string &filePath);
+    /**
+     * @brief free every sound even if still acquired e.g. before Mix_CloseAudio(), later releases are ignored
+     */
+    void clear();
+    /**
+     * @brief sounds currently loaded
+     */
+    size_t get_sound_count() const;
+    /**
+     * @brief Mix_LoadWAV calls made, equals unique sounds loaded rather than acquire() calls
+     */
+    unsigned long long get_load_count() const;
+};
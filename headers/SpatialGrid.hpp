@@ -0,0 +1,75 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <vector>
+#include <SDL2/SDL.h>
+#include "Entity.hpp"
+
+/**
+ * @brief uniform grid spatial index of the game world entities
+ *
+ * The game world is split into cellSize x cellSize cells, each cell lists the entities overlapping it.
+ * Looking up the entities in an area only visits the cells under it instead of every entity in the world
+ * e.g. the minimap markers around the camera.
+ *
+ * The grid is rebuilt from the entities vector once per gameplay update, after entities have moved.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "SpatialGrid.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern SpatialGrid spatialGrid;
+ * then in your globals.cpp as below
+ * SpatialGrid spatialGrid(256);
+ *
+ * 3. Rebuild after entities move
+ * spatialGrid.rebuild(entities, GAME_WORLD_WIDTH, GAME_WORLD_HEIGHT);
+ *
+ * 4. Find entities in an area of the game world
+ * std::vector<Entity *> found{};
+ * spatialGrid.query(cameraRect, found);
+ */
+class SpatialGrid
+{
+private:
+    int cellSize{};                             /**< cell width and height in game world pixels */
+    int columns{};                              /**< cells across the game world */
+    int rows{};                                 /**< cells down the game world */
+    std::vector<std::vector<Entity *>> cells{}; /**< entities overlapping each cell, row major */
+
+public:
+    /**
+     * @param cellSize cell width and height in game world pixels
+     */
+    SpatialGrid(int cellSize);
+    ~SpatialGrid();
+    /**
+     * @brief insert every entity into the cells it overlaps
+     *
+     * Cell vectors keep their capacity between rebuilds so rebuilding doesn't allocate once warmed up
+     *
+     * @param entities all entities in the scene
+     * @param gameWorldWidth game world width the grid covers
+     * @param gameWorldHeight game world height the grid covers
+     */
+    void rebuild(const std::vector<Entity *> &entities, int gameWorldWidth, int gameWorldHeight);
+    /**
+     * @brief find the entities overlapping an area
+     *
+     * @param area game world area to search
+     * @param found cleared then filled with each overlapping entity once
+     */
+    void query(const SDL_Rect &area, std::vector<Entity *> &found) const;
+    /**
+     * @brief forget all entities e.g. before the entities vector is deleted
+     */
+    void clear();
+};
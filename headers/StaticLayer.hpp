@@ -0,0 +1,132 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+#include "Entity.hpp"
+
+/**
+ * @brief game world static layer baked into fixed size chunk textures
+ *
+ * Entities that never animate or move on their own (e.g. mountains, trees, rivers) are drawn once into
+ * transparent render target chunks of chunkSize x chunkSize game world pixels. Each frame only the few chunks
+ * overlapping the camera are copied to the renderer over the background, so static scenery costs the same
+ * handful of copies no matter how many props a level has. The background isn't baked, it's stretched over
+ * the window and stays still while the camera moves, which world space chunks can't show.
+ *
+ * update() tracks the static entities positions, only chunks overlapping an entity that was added, removed or
+ * moved are baked again the next time they're visible.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "StaticLayer.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern StaticLayer staticLayer;
+ * then in your globals.cpp as below
+ * StaticLayer staticLayer(512);
+ *
+ * 3. Every gameplay frame update the static entities then draw the chunks under the camera over the background
+ * staticLayer.update(entities, [](Entity *e) { return dynamic_cast<Obstacle *>(e) != nullptr; });
+ * renderer->copy(background1Texture, nullptr, nullptr);
+ * staticLayer.draw(renderer, viewRect, GAME_WORLD_WIDTH, GAME_WORLD_HEIGHT);
+ *
+ * 4. Skip baked entities when drawing the rest of the entities
+ * if (staticLayer.is_baked(e)) continue;
+ *
+ * 5. Rebake everything when a level loads or the level editor changes it
+ * staticLayer.invalidate();
+ *
+ * 6. Destroy chunk textures before destroying the renderer
+ * staticLayer.clear();
+ */
+class StaticLayer
+{
+private:
+    struct Chunk
+    {
+        SDL_Texture *texture{}; /**< transparent render target with the chunks static entities */
+        bool dirty = true;      /**< bake again before the next copy */
+    };
+    struct BakedEntity
+    {
+        SDL_Rect rect{};        /**< position the entity was baked at */
+        unsigned int seen{};    /**< last update() the entity was found in */
+    };
+
+    int chunkSize{};                                          /**< chunk width and height in game world pixels */
+    int worldWidth{};                                         /**< game world width the chunk grid covers */
+    int worldHeight{};                                        /**< game world height the chunk grid covers */
+    int columns{};                                            /**< chunks across the game world */
+    int rows{};                                               /**< chunks down the game world */
+    std::vector<Chunk> chunks{};                              /**< chunk grid, row major */
+    RenderBackend *renderer{};                                /**< renderer the chunk textures were created with, for clear() */
+    std::unordered_map<Entity *, BakedEntity> bakedEntities{}; /**< static entities drawn into the chunks */
+    unsigned int updateCount{};                               /**< increased by update() to find removed entities */
+    bool available{};                                         /**< false if the last draw() couldn't use render targets */
+    int chunksDrawn{};                                        /**< chunks copied by the last draw() */
+    unsigned int revision{};                                  /**< increased whenever a static entity is added, moved or removed */
+
+    void resize_grid(int width, int height);
+    void mark_dirty(const SDL_Rect &worldRect);
+    void bake_chunk(RenderBackend *renderer, Chunk &chunk, int column, int row);
+
+public:
+    /**
+     * @param chunkSize chunk width and height in game world pixels
+     */
+    StaticLayer(int chunkSize);
+    ~StaticLayer();
+    /**
+     * @brief track the static entities and mark the chunks they moved in/out of dirty
+     *
+     * @param entities all entities in the scene
+     * @param isStatic returns true for entities to bake e.g. obstacles with one texture
+     */
+    void update(const std::vector<Entity *> &entities, const std::function<bool(Entity *)> &isStatic);
+    /**
+     * @brief copy the chunks overlapping the view over what's already drawn, baking dirty or new chunks first
+     *
+     * @param renderer renderer to draw on
+     * @param viewRect camera position in game world coordinates with the window dimensions
+     * @param gameWorldWidth game world width, the chunk grid is rebuilt when it changes
+     * @param gameWorldHeight game world height, the chunk grid is rebuilt when it changes
+     * @return false if render targets aren't supported, draw the static entities directly instead
+     */
+    bool draw(RenderBackend *renderer, const SDL_Rect &viewRect, int gameWorldWidth, int gameWorldHeight);
+    /**
+     * @brief check if an entity is drawn by the static layer
+     *
+     * @param e entity to check
+     * @return true if draw_entities() should skip it
+     */
+    bool is_baked(Entity *e) const;
+    /**
+     * @brief forget all static entities and bake every chunk again e.g. on level load
+     */
+    void invalidate();
+    /**
+     * @brief destroy all chunk textures
+     *
+     * call before the renderer is destroyed or recreated
+     */
+    void clear();
+    /**
+     * @brief number of chunks copied by the last draw() for the debug overlay
+     */
+    int get_chunks_drawn() const;
+    /**
+     * @brief revision increased whenever the static entities change e.g. to redraw the minimap terrain
+     */
+    unsigned int get_revision() const;
+};
@@ -0,0 +1,133 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief least recently used (LRU) cache of rendered text textures
+ *
+ * render_text() used to rasterise, upload and destroy a texture for every string every frame.
+ * This class keeps the texture for each (text, font, color) so static labels are only rasterised
+ * once. When the total texture memory goes over the budget the least recently drawn text is destroyed.
+ *
+ * Textures belong to the renderer that created them, so clear() must be called before the
+ * renderer is destroyed e.g. recreate_renderer() and exit_SDL()
+ *
+ * @param budgetBytes maximum bytes of texture memory (width * height * 4) to keep cached
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "TextCache.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern TextCache textCache;
+ * then in your globals.cpp as below
+ * TextCache textCache(8 * 1024 * 1024);
+ *
+ * 3. Get a texture to draw
+ * int w, h;
+ * SDL_Texture *t = textCache.get_texture(renderer, "Score: 1", font24, {0, 0, 0, 255}, w, h);
+ *
+ * 4. Reset per frame statistics at the start of each frame
+ * textCache.begin_frame();
+ */
+class TextCache
+{
+private:
+    struct TextKey
+    {
+        std::string text{}; /**< UTF-8 string that was rendered */
+        TTF_Font *font{};   /**< font pointer the string was rendered with */
+        Uint32 color{};     /**< packed RGBA color */
+
+        bool operator==(const TextKey &other) const
+        {
+            return font == other.font && color == other.color && text == other.text;
+        }
+    };
+    struct TextKeyHash
+    {
+        size_t operator()(const TextKey &key) const
+        {
+            size_t h = std::hash<std::string>()(key.text);
+            h ^= std::hash<const void *>()(key.font) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<Uint32>()(key.color) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+    struct TextEntry
+    {
+        TextKey key{};
+        SDL_Texture *texture{};
+        int width{};
+        int height{};
+        size_t bytes{};
+    };
+
+    std::list<TextEntry> entries{}; /**< most recently used at the front */
+    RenderBackend *renderer{};      /**< renderer the cached textures were created with, for clear() */
+    std::unordered_map<TextKey, std::list<TextEntry>::iterator, TextKeyHash> lookup{}; /**< key to position in entries */
+    size_t budgetBytes{};  /**< max texture memory before evicting */
+    size_t usedBytes{};    /**< current texture memory of all entries */
+    int frameHits{};       /**< hits since begin_frame() */
+    int frameMisses{};     /**< misses since begin_frame() */
+    int lastFrameHits{};   /**< hits of the previous complete frame for debug overlay */
+    int lastFrameMisses{}; /**< misses of the previous complete frame for debug overlay */
+
+    void evict_to_budget();
+
+public:
+    /**
+     * @brief TextCache class constructor
+     *
+     * @param budgetBytes maximum bytes of texture memory to keep cached
+     */
+    explicit TextCache(size_t budgetBytes);
+    /**
+     * @brief TextCache class Deconstructor
+     *
+     * Textures are not destroyed here as the renderer is already destroyed by the time
+     * globals are deconstructed, call clear() before the renderer is destroyed
+     */
+    ~TextCache();
+    /**
+     * @brief get a cached texture for text or rasterise it on a miss
+     *
+     * @param renderer renderer to create the texture on
+     * @param text UTF-8 string to render
+     * @param font font to render with
+     * @param color text color
+     * @param width returns texture width
+     * @param height returns texture height
+     * @return texture owned by the cache, do not destroy. nullptr if rendering failed
+     */
+    SDL_Texture *get_texture(RenderBackend *renderer, const std::string &text, TTF_Font *font, SDL_Color color, int &width, int &height);
+    /**
+     * @brief destroy all cached textures
+     *
+     * call before the renderer is destroyed or recreated
+     */
+    void clear();
+    /**
+     * @brief store this frames hit/miss statistics and reset the counters
+     *
+     * call once at the start of each frame
+     */
+    void begin_frame();
+    int get_last_frame_hits() const;
+    int get_last_frame_misses() const;
+    size_t get_used_bytes() const;
+    size_t get_entry_count() const;
+};
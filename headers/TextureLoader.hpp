@@ -0,0 +1,139 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief load image files into textures without blocking the main thread
+ *
+ * Worker threads read and decode image files into SDL_Surfaces (disk reads and PNG/zlib decoding). The main
+ * thread then creates the textures in upload(), called once per frame, which stops after uploadBudget bytes of
+ * pixels so a burst of loads is spread over several frames. Until a texture is uploaded load() hands out a
+ * transparent placeholder texture so it can be drawn straight away.
+ *
+ * The onLoaded callback runs on the main thread inside upload() with the new texture, or nullptr if the image
+ * couldn't be loaded, whatever it writes to must outlive the load e.g. a global texture or a button member.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "TextureLoader.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern TextureLoader textureLoader;
+ * then in your globals.cpp as below, upload at most 4MB of pixels per frame
+ * TextureLoader textureLoader(4 * 1024 * 1024);
+ *
+ * 3. Start the worker threads after IMG_Init()
+ * textureLoader.start(2);
+ *
+ * 4. Request a texture, it's the placeholder until it's uploaded
+ * background1Texture = textureLoader.load(renderer, "background.png", [](SDL_Texture *t) { background1Texture = t; });
+ *
+ * 5. Upload decoded images once per frame in the event loop
+ * textureLoader.upload(renderer);
+ *
+ * 6. Finish pending loads before destroying the renderer then stop the threads on exit
+ * textureLoader.finish(renderer);
+ * textureLoader.stop();
+ */
+class TextureLoader
+{
+private:
+    struct Request
+    {
+        unsigned int id{};  /**< matches the callback in callbacks */
+        std::string path{}; /**< image file to decode */
+    };
+    struct Decoded
+    {
+        unsigned int id{};       /**< matches the callback in callbacks */
+        std::string path{};      /**< image file for error messages */
+        SDL_Surface *surface{};  /**< decoded pixels, nullptr if decoding failed */
+    };
+
+    std::vector<std::thread> workers{};      /**< decode threads */
+    std::mutex mutex{};                      /**< guards requests, decoded, busyWorkers and stopping */
+    std::condition_variable requestReady{};  /**< wakes workers when a request is queued or on stop() */
+    std::condition_variable workerIdle{};    /**< wakes finish() when a worker finishes a request */
+    std::deque<Request> requests{};          /**< images waiting for a worker */
+    std::deque<Decoded> decoded{};           /**< decoded images waiting for upload() */
+    int busyWorkers{};                       /**< workers decoding right now */
+    bool stopping{};                         /**< set by stop() to end the worker threads */
+
+    std::unordered_map<unsigned int, std::function<void(SDL_Texture *)>> callbacks{}; /**< main thread only */
+    unsigned int nextId{};                   /**< id of the next request */
+    SDL_Texture *placeholder{};              /**< 1x1 transparent texture handed out until the real one is uploaded */
+    RenderBackend *placeholderRenderer{};    /**< renderer placeholder belongs to */
+    size_t uploadBudget{};                   /**< max bytes of pixels upload() creates textures from per call */
+    std::function<void()> onDecoded{};       /**< called from a worker thread after each decode e.g. to wake the event loop */
+
+    void worker_loop();
+    SDL_Texture *get_placeholder(RenderBackend *renderer);
+
+public:
+    /**
+     * @param uploadBudget max bytes of pixels uploaded per upload() call, at least one image is always uploaded
+     */
+    TextureLoader(size_t uploadBudget);
+    ~TextureLoader();
+    /**
+     * @brief start the worker threads, without them load() decodes on the calling thread
+     *
+     * @param workerCount number of decode threads
+     */
+    void start(int workerCount);
+    /**
+     * @brief stop and join the worker threads, decoded images not yet uploaded are freed
+     */
+    void stop();
+    /**
+     * @brief set a function called from the worker threads when an image is decoded
+     *
+     * @param callback e.g. wake_event_loop so a waiting event loop uploads it
+     */
+    void set_decoded_callback(std::function<void()> callback);
+    /**
+     * @brief queue an image file to be decoded and uploaded
+     *
+     * @param renderer renderer to create the placeholder with
+     * @param filePath image file to load
+     * @param onLoaded called from upload() with the texture, or nullptr if loading failed
+     * @return placeholder texture to use until onLoaded is called
+     */
+    SDL_Texture *load(RenderBackend *renderer, const std::string &filePath, std::function<void(SDL_Texture *)> onLoaded);
+    /**
+     * @brief create textures from decoded images within the per frame budget
+     *
+     * @param renderer renderer to create textures with
+     * @return number of textures passed to their onLoaded callbacks
+     */
+    int upload(RenderBackend *renderer);
+    /**
+     * @brief wait for every queued image and upload them all, then destroy the placeholder
+     *
+     * call before the renderer is destroyed or recreated
+     *
+     * @param renderer renderer to create textures with
+     */
+    void finish(RenderBackend *renderer);
+    /**
+     * @brief number of images queued or decoded but not yet uploaded
+     */
+    size_t get_pending_count() const;
+};
@@ -0,0 +1,220 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <SDL2/SDL_mixer.h>
+
+/**
+ * @brief how important a sound is when every mixer channel is playing
+ */
+enum class SoundPriority
+{
+    LOW,    /**< e.g. repeated collision bumps, first to be stolen */
+    NORMAL, /**< e.g. pickups */
+    HIGH    /**< e.g. winning or losing a game, only stolen by other HIGH sounds */
+};
+
+/**
+ * @brief mixer channel (voice) allocation for sound effects
+ *
+ * Instead of calling Mix_PlayChannel(-1, ...) directly, sounds are requested with play() and started once per
+ * frame by flush(). Requests for the same sound in one frame are coalesced into one voice, e.g. 10 entities
+ * colliding on the same frame play one bump. Each sound can be limited to a number of voices playing at once
+ * and given a priority. When every channel is busy the new sound steals a voice of the same or lower priority,
+ * the lowest priority then quietest then oldest, otherwise it is dropped.
+ *
+ * Sounds played with play_at() are positioned relative to the nearest listener e.g. the camera centre of each
+ * split-screen view, panned by direction and attenuated by distance with Mix_SetPosition(). Sounds beyond the
+ * audible radius of every listener are culled before they take a channel, and coalesced requests keep the
+ * nearest position.
+ *
+ * Requested, coalesced, culled, limited, stolen, dropped and played sounds are counted.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "VoiceManager.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern VoiceManager voiceManager;
+ * then in your globals.cpp as below, 16 channels, at most 2 voices per sound unless set otherwise and
+ * positional sounds heard up to 1600 pixels away
+ * VoiceManager voiceManager(16, 2, 1600.0f);
+ *
+ * 3. Allocate the channels after Mix_OpenAudio() and set any per sound limits
+ * voiceManager.open();
+ * voiceManager.set_sound_limit(winGameSound, 1, SoundPriority::HIGH);
+ *
+ * 4. Request sounds during the frame, positional sounds after setting the listeners, one per view
+ * voiceManager.play(winGameSound);
+ * voiceManager.set_listener(cameraRect.x + SCREEN_WIDTH / 2.0f, cameraRect.y + SCREEN_HEIGHT / 2.0f);
+ * voiceManager.add_listener(secondCameraRect.x + secondCameraRect.w / 2.0f, secondCameraRect.y + secondCameraRect.h / 2.0f);
+ * voiceManager.play_at(bumpSound, treeRect.x, treeRect.y);
+ *
+ * 5. Start the requested sounds once per frame
+ * voiceManager.flush();
+ */
+class VoiceManager
+{
+private:
+    struct SoundLimit
+    {
+        int maxVoices{};          /**< voices of the sound playing at once */
+        SoundPriority priority{}; /**< priority of every voice of the sound */
+    };
+    struct Voice
+    {
+        Mix_Chunk *chunk{};            /**< sound playing on the channel, nullptr if the channel is free */
+        SoundPriority priority{};      /**< priority it was started with */
+        int volume{};                  /**< requested volume before the master volume */
+        Uint8 distance{};              /**< Mix_SetPosition distance, 0 is at the listener */
+        unsigned long long started{};  /**< order voices were started in, lower is older */
+    };
+    struct Listener
+    {
+        float x{};          /**< game world position sounds are heard from */
+        float y{};
+    };
+    struct Request
+    {
+        Mix_Chunk *chunk{};
+        int volume{};
+        bool positional{};  /**< false plays centred at full volume */
+        Sint16 angle{};     /**< Mix_SetPosition angle, 0 is up 90 is right */
+        Uint8 distance{};   /**< Mix_SetPosition distance, 0 is at the listener 255 at the audible radius */
+    };
+
+    int channelCount{};                                    /**< mixer channels allocated by open() */
+    int defaultMaxVoices{};                                /**< voice limit of sounds without set_sound_limit() */
+    int masterVolume = MIX_MAX_VOLUME;                     /**< scales every voice volume, 0 to MIX_MAX_VOLUME */
+    float audibleRadius{};                                 /**< play_at() sounds further than this from the listener are culled */
+    std::vector<Listener> listeners{};                     /**< empty until set_listener(), play_at() then plays like play() */
+    std::vector<Voice> voices{};                           /**< voice by channel */
+    std::vector<Request> pending{};                        /**< sounds requested this frame, one per sound */
+    std::unordered_map<Mix_Chunk *, SoundLimit> limits{};  /**< limit by sound set with set_sound_limit() */
+    unsigned long long startedCount{};                     /**< voices started, gives Voice::started */
+    unsigned long long requestedCount{};                   /**< play() and play_at() calls */
+    unsigned long long coalescedCount{};                   /**< play() calls merged into one already requested this frame */
+    unsigned long long culledCount{};                      /**< play_at() calls beyond the audible radius */
+    unsigned long long limitedCount{};                     /**< sounds not played because the sound had maxVoices playing */
+    unsigned long long stolenCount{};                      /**< voices halted to play a new sound */
+    unsigned long long droppedCount{};                     /**< sounds not played because no channel could be used */
+    unsigned long long playedCount{};                      /**< voices started */
+
+    SoundLimit get_limit(Mix_Chunk *chunk) const;
+    /**
+     * @brief add a request, or merge it into this frames request for the same sound keeping the louder one
+     */
+    void queue(const Request &request);
+    /**
+     * @brief how loud a voice is heard, volume scaled down by distance
+     */
+    static int get_loudness(int volume, Uint8 distance);
+    /**
+     * @brief free channel, or the voice to steal for a sound of a priority
+     * @return channel, -1 if every voice has a higher priority
+     */
+    int find_channel(SoundPriority priority) const;
+
+public:
+    /**
+     * @param channelCount mixer channels to allocate
+     * @param defaultMaxVoices voices playing at once of sounds without set_sound_limit()
+     * @param audibleRadius game world distance from the listener play_at() sounds are heard up to
+     */
+    VoiceManager(int channelCount, int defaultMaxVoices, float audibleRadius);
+    ~VoiceManager();
+    /**
+     * @brief allocate the mixer channels, call after Mix_OpenAudio()
+     */
+    void open();
+    /**
+     * @brief set how many voices of a sound may play at once and its priority
+     *
+     * @param chunk the sound
+     * @param maxVoices voices playing at once, further requests are dropped until one finishes
+     * @param priority priority when channels run out
+     */
+    void set_sound_limit(Mix_Chunk *chunk, int maxVoices, SoundPriority priority);
+    /**
+     * @brief set the volume every voice is scaled by, applied to playing voices straight away
+     *
+     * @param volume 0 to MIX_MAX_VOLUME
+     */
+    void set_volume(int volume);
+    /**
+     * @brief request a sound, it starts on the next flush()
+     *
+     * @param chunk the sound, nullptr is ignored
+     * @param volume 0 to MIX_MAX_VOLUME, the loudest request is kept when coalesced
+     */
+    void play(Mix_Chunk *chunk, int volume = MIX_MAX_VOLUME);
+    /**
+     * @brief set where positional sounds are heard from, replacing every listener, call before play_at() e.g. once per update
+     *
+     * @param x game world x position e.g. the camera centre
+     * @param y game world y position
+     */
+    void set_listener(float x, float y);
+    /**
+     * @brief add another listener e.g. the camera centre of each split-screen view, play_at() uses the nearest
+     *
+     * @param x game world x position
+     * @param y game world y position
+     */
+    void add_listener(float x, float y);
+    /**
+     * @brief request a sound at a game world position, panned and attenuated relative to the nearest listener
+     *
+     * Culled without taking a channel if it's beyond the audible radius of every listener
+     *
+     * @param chunk the sound, nullptr is ignored
+     * @param x game world x position of the sound
+     * @param y game world y position of the sound
+     * @param volume 0 to MIX_MAX_VOLUME before attenuation
+     */
+    void play_at(Mix_Chunk *chunk, float x, float y, int volume = MIX_MAX_VOLUME);
+    /**
+     * @brief start the sounds requested this frame, highest priority first, call once per frame
+     */
+    void flush();
+    /**
+     * @brief halt every voice and forget pending requests and limits e.g. before the sounds are freed
+     */
+    void clear();
+    /**
+     * @brief play() and play_at() calls
+     */
+    unsigned long long get_requested_count() const;
+    /**
+     * @brief voices started
+     */
+    unsigned long long get_played_count() const;
+    /**
+     * @brief play() calls merged into another request for the same sound in the same frame
+     */
+    unsigned long long get_coalesced_count() const;
+    /**
+     * @brief play_at() calls culled for being beyond the audible radius
+     */
+    unsigned long long get_culled_count() const;
+    /**
+     * @brief sounds not played because the sound already had its limit of voices playing
+     */
+    unsigned long long get_limited_count() const;
+    /**
+     * @brief voices halted to play a new sound
+     */
+    unsigned long long get_stolen_count() const;
+    /**
+     * @brief sounds not played because every channel had a higher priority voice
+     */
+    unsigned long long get_dropped_count() const;
+};
@@ -0,0 +1,86 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Declaration file
+    License: MIT License
+*/
+
+#pragma once
+
+#include <SDL2/SDL.h>
+#include "RenderBackend.hpp"
+
+/**
+ * @brief RenderBackend drawing to a window with an SDL_Renderer
+ *
+ * Every call is the SDL_Render*() or texture function of the same name on the SDL_Renderer it owns.
+ *
+ * EXAMPLE
+ *
+ * 1. Include this header
+ * include "WindowRenderer.hpp"
+ *
+ * 2. Create object instance e.g. in your globals.hpp as an extern variable: extern WindowRenderer windowRenderer;
+ * then in your globals.cpp as below
+ * WindowRenderer windowRenderer{};
+ *
+ * 3. Create the SDL_Renderer for a window, again to change flags e.g. vsync, textures of the old one are freed
+ * windowRenderer.create(window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+ * renderer = &windowRenderer;
+ *
+ * 4. Destroy on exit
+ * windowRenderer.destroy();
+ */
+class WindowRenderer : public RenderBackend
+{
+private:
+    SDL_Renderer *sdlRenderer{}; /**< renderer of the window, nullptr until create() */
+
+protected:
+    int draw_clear() override;
+    int draw_fill_rects(const SDL_Rect *rects, int count) override;
+    int draw_outline_rect(const SDL_Rect *rect) override;
+    int draw_line_segment(int x1, int y1, int x2, int y2) override;
+    int draw_copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst) override;
+    int draw_geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount) override;
+    void present_frame() override;
+
+public:
+    WindowRenderer();
+    ~WindowRenderer();
+    /**
+     * @brief create the SDL_Renderer, destroying any previous one and its textures
+     *
+     * @param window window to draw to
+     * @param flags SDL_CreateRenderer() flags e.g. SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
+     * @return true if it was created
+     */
+    bool create(SDL_Window *window, Uint32 flags);
+    /**
+     * @brief destroy the SDL_Renderer and every texture it created
+     */
+    void destroy();
+    /**
+     * @brief whether textures can be created with SDL_TEXTUREACCESS_TARGET, SDL_RenderTargetSupported()
+     */
+    bool supports_targets();
+
+    int set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a) override;
+    int get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a) override;
+    int set_draw_blend_mode(SDL_BlendMode blendMode) override;
+    int get_draw_blend_mode(SDL_BlendMode *blendMode) override;
+    int set_target(SDL_Texture *texture) override;
+    SDL_Texture *get_target() override;
+    int set_viewport(const SDL_Rect *rect) override;
+    void get_viewport(SDL_Rect *rect) override;
+    int set_clip_rect(const SDL_Rect *rect) override;
+    int get_output_size(int *w, int *h) override;
+
+    SDL_Texture *create_texture(Uint32 format, int access, int w, int h) override;
+    SDL_Texture *create_texture_from_surface(SDL_Surface *surface) override;
+    int update_texture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch) override;
+    int update_yuv_texture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *yPlane, int yPitch, const Uint8 *uPlane, int uPitch, const Uint8 *vPlane, int vPitch) override;
+    int set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode) override;
+    void destroy_texture(SDL_Texture *texture) override;
+};
@@ -14,9 +14,13 @@
 #include <cmath>  // for std::fabs() velocity, and sqrt for button class Euclidean distance calculations
 #include <limits> // For Shortest path - Euclidean Distance calculation
 #include <vector>
+#include <utility>    // for std::pair in drawnButtons
+#include <functional> // for std::hash in get_draw_signature()
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
+#include "../TextureLoader.hpp"
+#include "../RenderBackend.hpp"
 
 /**
  * @brief A Base class for initialisating SDL button subclasses e.g. push buttons, sliders, text fields
@@ -515,9 +519,26 @@ protected:
     static BaseButton *selectedButton;     /**< Static pointer for every BaseButton and subclass objects to track which is selected */
     bool isSelected{};                     /**< set button to isSelected for highlighting, pressing key inputs enter/A to traverse, and using as base navigation point */
     bool isClicked{};                      /**< flag to indicate button was clicked e.g. for Push Button SUBMIT to trigger submitting InputButton text */
-    SDL_Renderer *renderer{};              /**< Dynamically set renderer anytime with set_renderer() for drawing button */
+    RenderBackend *renderer{};              /**< Dynamically set renderer anytime with set_renderer() for drawing button */
+    SDL_Texture *labelTexture{};           /**< buttonLabel rasterised once with buttonFont, rebuilt when labelTextureDirty */
+    int labelTextureWidth{};               /**< labelTexture width for centering in buttonRect */
+    int labelTextureHeight{};              /**< labelTexture height for centering in buttonRect */
+    bool labelTextureDirty = true;         /**< set by set_button_label(), set_font_size() and invalidate_label_texture() */
+    unsigned int labelTextureGeneration{}; /**< renderer generation labelTexture was created in, not destroyed if the renderer was recreated */
+
+    /**
+     * @brief combine a value into get_draw_signature()
+     */
+    template <typename T>
+    static void hash_combine(size_t &signature, const T &value)
+    {
+        signature ^= std::hash<T>()(value) + 0x9e3779b9 + (signature << 6) + (signature >> 2);
+    }
 
 public:
+    static bool recordingDrawnButtons;                               /**< set by MenuCompositor while drawing a scene into its cached texture */
+    static std::vector<std::pair<BaseButton *, SDL_Rect>> drawnButtons; /**< buttons and the rect they were drawn at while recordingDrawnButtons */
+
     /**
      * @brief this is an abstract (base) class not meant for constructing
      * the subclasses that inherit from this are meant to be initialised into a vector of type
@@ -549,18 +570,45 @@ public:
      */
     virtual ~BaseButton()
     {
+        invalidate_label_texture();
         std::cout << "Deconstructed: Button: " << buttonLabel << std::endl;
     }
 
     /**
      * @brief dynamically set renderer
-     * @param r pass a SDL_Renderer *r object for this entity to render on with render_texture()
+     * @param r pass a RenderBackend *r object for this entity to render on with render_texture()
      * */
-    void set_renderer(SDL_Renderer *r)
+    void set_renderer(RenderBackend *r)
     {
+        if (r != renderer)
+        {
+            // textures of the previous renderer are freed with it, so only forget them
+            labelTexture = nullptr;
+            labelTextureDirty = true;
+        }
         renderer = r;
     }
 
+    /**
+     * @brief destroy the cached label texture so it's rasterised again on next render
+     *
+     * called automatically by set_button_label() and set_font_size(), call directly when the language/font
+     * changes or before the renderer is destroyed e.g. recreate_renderer()
+     */
+    virtual void invalidate_label_texture()
+    {
+        if (labelTexture)
+        {
+            // a recreated renderer already freed it
+            if (labelTextureGeneration == renderer->get_generation())
+            {
+                renderer->destroy_texture(labelTexture);
+            }
+            labelTexture = nullptr;
+        }
+        labelTextureDirty = true;
+    }
+
     /**
      * @brief when an SDL mouse handle
      *
@@ -608,7 +656,11 @@ public:
      */
     void set_button_label(std::string newButtonLabel)
     {
-        buttonLabel = newButtonLabel;
+        if (newButtonLabel != buttonLabel)
+        {
+            buttonLabel = newButtonLabel;
+            invalidate_label_texture();
+        }
     }
 
     /**
@@ -700,74 +752,130 @@ public:
     {
         if (!buttonTexturePath.empty())
         {
-            buttonTexture = IMG_LoadTexture(renderer, buttonTexturePath.c_str());
+            buttonTexture = renderer->load_texture(buttonTexturePath);
             if (!buttonTexture)
             {
                 std::cout << "Error: Failed to load button image: " << buttonTexturePath << IMG_GetError() << std::endl;
             }
         }
     }
-
     /**
-     * @brief render button font text to window
-     *
-     * Accepts a text string with styling parameters to write to window to show messages/label in GUI.
-     * Uses SDL framework and traditionally loaded with TTF_Font *load_font() which returns a TTF_Font *font object
-     *
-     * EXAMPLE
+     * @brief set button texture passed from constructor without blocking on the image decode
      *
-     * The below will draw a solid black "Hello World" message in the top left of window
-     *
-     * render_text("Hello World", (SCREEN_WIDTH * 0.35), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
+     * The loaders placeholder is drawn until the texture is uploaded by loader.upload()
      *
+     * @param loader texture loader that decodes the image on a worker thread
+     */
+    void set_button_texture(TextureLoader &loader)
+    {
+        if (!buttonTexturePath.empty())
+        {
+            buttonTexture = loader.load(renderer, buttonTexturePath, [this](SDL_Texture *texture)
+                                        { buttonTexture = texture; });
+        }
+    }
+
+    /**
+     * @brief rasterise buttonLabel into labelTexture if it was invalidated
      *
-     * @param text message to render to the window
-     * @param x x coordinate to draw the text to window
-     * @param y y coordinate to draw the text to window
-     * @param redText text rgb red value, use in conjunction with other rgb variable values
-     * @param greenText text rgb green value, use in conjunction with other rgb variable values
-     * @param blueText text rgb blue value, use in conjunction with other rgb variable values
-     * @param alphaText the transparency. alpha value 255 - solid, value 1 = transparent, alpha value 0 breaks and becomes transparent again. Just use 1;
+     * @return false if the label couldn't be rendered
      */
-    void render_button_text(const std::string &text, SDL_Rect buttonRect, SDL_Color textColor)
+    bool update_label_texture()
     {
-        if (buttonFont)
+        if (!labelTextureDirty)
         {
-            SDL_Surface *textSurface = TTF_RenderUTF8_Blended(buttonFont, text.c_str(), textColor);
+            return labelTexture != nullptr;
+        }
+        labelTextureDirty = false;
 
-            if (textSurface)
-            {
-                int textWidth, textHeight;
-                // Calculate textWidth and textHeight using TTF_SizeText
-                TTF_SizeText(buttonFont, text.c_str(), &textWidth, &textHeight);
+        if (!buttonFont)
+        {
+            std::cout << "Error: Button font is not initialized" << TTF_GetError() << std::endl;
+            return false;
+        }
+        if (buttonLabel.empty())
+        {
+            return false;
+        }
 
-                SDL_Texture *textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-                SDL_FreeSurface(textSurface);
+        SDL_Surface *textSurface = TTF_RenderUTF8_Blended(buttonFont, buttonLabel.c_str(), buttonTextColor);
+        if (!textSurface)
+        {
+            std::cout << "Error: Unable to render text to surface" << TTF_GetError() << std::endl;
+            return false;
+        }
 
-                if (textTexture)
-                {
-                    // Calculate the center position for the text
-                    int x = buttonRect.x + (buttonRect.w - textWidth) / 2;
-                    int y = buttonRect.y + (buttonRect.h - textHeight) / 2;
+        labelTextureWidth = textSurface->w;
+        labelTextureHeight = textSurface->h;
+        labelTexture = renderer->create_texture_from_surface(textSurface);
+        labelTextureGeneration = renderer->get_generation();
+        SDL_FreeSurface(textSurface);
+        if (!labelTexture)
+        {
+            std::cout << "Error: Unable to create text texture" << SDL_GetError() << std::endl;
+            return false;
+        }
+        return true;
+    }
 
-                    SDL_Rect textRect = {x, y, textWidth, textHeight};
-                    SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
+    /**
+     * @brief render button label centered in the button rect
+     *
+     * The label is rasterised once into labelTexture by update_label_texture() and reused every frame
+     * until set_button_label(), set_font_size() or invalidate_label_texture() is called
+     *
+     * EXAMPLE
+     *
+     * called at the end of render_button_rect() to draw label on top of the button
+     * render_button_text();
+     */
+    void render_button_text()
+    {
+        if (update_label_texture())
+        {
+            // Calculate the center position for the text
+            int x = buttonRect.x + (buttonRect.w - labelTextureWidth) / 2;
+            int y = buttonRect.y + (buttonRect.h - labelTextureHeight) / 2;
 
-                    SDL_DestroyTexture(textTexture);
-                }
-                else
-                {
-                    std::cout << "Error: Unable to create text texture" << TTF_GetError() << std::endl;
-                }
-            }
-            else
-            {
-                std::cout << "Error: Unable to render text to surface" << TTF_GetError() << std::endl;
-            }
+            SDL_Rect textRect = {x, y, labelTextureWidth, labelTextureHeight};
+            renderer->copy(labelTexture, nullptr, &textRect);
         }
-        else
+    }
+
+    /**
+     * @brief hash everything render_button_rect() draws
+     *
+     * MenuCompositor compares this with the value from when the button was drawn into its cached texture and
+     * redraws only the buttons rect when it differs e.g. selected highlight moved. Subclasses add what they
+     * draw on top e.g. SliderButton dot, InputButton text
+     *
+     * @return signature of the buttons current look
+     */
+    virtual size_t get_draw_signature() const
+    {
+        size_t signature{};
+        hash_combine(signature, buttonRect.x);
+        hash_combine(signature, buttonRect.y);
+        hash_combine(signature, buttonRect.w);
+        hash_combine(signature, buttonRect.h);
+        hash_combine(signature, isSelected);
+        hash_combine(signature, buttonLabel);
+        hash_combine(signature, static_cast<const void *>(buttonTexture));
+        hash_combine(signature, static_cast<const void *>(buttonFont));
+        return signature;
+    }
+
+    /**
+     * @brief remember this button was drawn into the cached menu texture
+     *
+     * called at the start of render_button_rect(), while MenuCompositor is composing a scene the button and its
+     * rect are added to drawnButtons so it can be redrawn alone when get_draw_signature() changes
+     */
+    void record_drawn()
+    {
+        if (recordingDrawnButtons)
         {
-            std::cout << "Error: Button font is not initialized" << TTF_GetError() << std::endl;
+            drawnButtons.emplace_back(this, buttonRect);
         }
     }
 
@@ -780,6 +888,7 @@ public:
      */
     virtual void render_button_rect()
     {
+        record_drawn();
         // If no Texture, draw boxes
         if (buttonTexturePath.empty())
         {
@@ -796,20 +905,20 @@ public:
                     thus this creates a border effect)
                 */
                 // Draw - YELLOW border
-                SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // yellow
+                renderer->set_draw_color(255, 255, 0, 255); // yellow
                 SDL_Rect borderRect = {buttonRect.x - 2, buttonRect.y - 2, buttonRect.w + 4, buttonRect.h + 4};
-                SDL_RenderFillRect(renderer, &borderRect);
+                renderer->fill_rect(&borderRect);
             }
             else
             {
                 // Draw - GREY border
-                SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // Grey
+                renderer->set_draw_color(255, 255, 255, 255); // Grey
                 SDL_Rect borderRect = {buttonRect.x - 2, buttonRect.y - 2, buttonRect.w + 4, buttonRect.h + 4};
-                SDL_RenderFillRect(renderer, &borderRect);
+                renderer->fill_rect(&borderRect);
             }
             // Draw button
-            SDL_SetRenderDrawColor(renderer, buttonColor.r, buttonColor.g, buttonColor.b, buttonColor.a);
-            SDL_RenderFillRect(renderer, &buttonRect);
+            renderer->set_draw_color(buttonColor.r, buttonColor.g, buttonColor.b, buttonColor.a);
+            renderer->fill_rect(&buttonRect);
         }
         else
         {
@@ -826,15 +935,15 @@ public:
                     thus this creates a border effect)
                 */
                 // Draw - YELLOW border
-                SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // yellow
+                renderer->set_draw_color(255, 255, 0, 255); // yellow
                 SDL_Rect borderRect = {buttonRect.x - 2, buttonRect.y - 2, buttonRect.w + 4, buttonRect.h + 4};
-                SDL_RenderFillRect(renderer, &borderRect);
+                renderer->fill_rect(&borderRect);
             }
             // Draw Texture
-            SDL_RenderCopy(renderer, buttonTexture, nullptr, &buttonRect);
+            renderer->copy(buttonTexture, nullptr, &buttonRect);
         }
         // Draw text
-        render_button_text(buttonLabel, buttonRect, buttonTextColor);
+        render_button_text();
     }
 
     /**
@@ -849,6 +958,7 @@ public:
     void set_font_size(TTF_Font *font, int size)
     {
         buttonFont = font;
+        invalidate_label_texture();
 
         if (size == 24)
         {
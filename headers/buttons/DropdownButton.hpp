@@ -49,7 +49,7 @@ public:
      *     scene2resolutionsDropdownButton.render_buttons_from_dropdown_list(renderer);
      * }
      */
-    void render_buttons_from_dropdown_list(SDL_Renderer *&renderer)
+    void render_buttons_from_dropdown_list(RenderBackend *renderer)
     {
             for (BaseButton *b : dropdownList)
             { // for every button in this drop down list
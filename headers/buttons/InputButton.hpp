@@ -18,7 +18,100 @@
 class InputButton : public BaseButton
 {
 private:
-    std::string inputText{}; /**< holds the value of text input into this text field button */
+    std::string inputText{};              /**< holds the value of text input into this text field button */
+    SDL_Texture *inputTexture{};          /**< whole displayed text rasterised with buttonFont, rebuilt when it changes */
+    std::string inputTextureText{};       /**< displayed text inputTexture was rasterised from */
+    int inputTextureWidth{};              /**< inputTexture width for centering and cropping in buttonRect */
+    int inputTextureHeight{};             /**< inputTexture height for centering in buttonRect */
+    RenderBackend *inputTextureRenderer{}; /**< renderer inputTexture was created on, recreated if the renderer changes */
+    unsigned int inputTextureGeneration{}; /**< renderer generation inputTexture was created in, recreated if the renderer was */
+    bool masked{};                        /**< draw one * per character instead of the text e.g. password fields */
+
+    /**
+     * @brief get the text drawn in the field
+     *
+     * @return inputText, or one * per UTF-8 character for masked fields
+     */
+    std::string get_display_text() const
+    {
+        if (!masked)
+        {
+            return inputText;
+        }
+        std::string stars{};
+        for (char c : inputText)
+        {
+            if ((static_cast<unsigned char>(c) & 0xC0) != 0x80) // count UTF-8 lead bytes only
+            {
+                stars += '*';
+            }
+        }
+        return stars;
+    }
+
+    /**
+     * @brief rasterise the whole displayed text into inputTexture if it changed
+     *
+     * The string is rendered in one TTF_RenderUTF8_Blended() call so kerning and shaping between characters
+     * (e.g. Devanagari, Arabic) match render_text(). It's only rendered again when the text differs from
+     * inputTextureText, so drawing the same text every frame reuses the texture
+     *
+     * @param text text to draw, from get_display_text()
+     * @return false if the text couldn't be rendered
+     */
+    bool update_input_texture(const std::string &text)
+    {
+        if (inputTextureRenderer != renderer || inputTextureGeneration != renderer->get_generation())
+        {
+            // the previous renderer freed this texture
+            inputTexture = nullptr;
+            inputTextureText.clear();
+            inputTextureRenderer = renderer;
+            inputTextureGeneration = renderer->get_generation();
+        }
+        if (inputTexture && text == inputTextureText)
+        {
+            return true;
+        }
+        free_input_texture();
+
+        if (!buttonFont)
+        {
+            return false;
+        }
+        SDL_Surface *textSurface = TTF_RenderUTF8_Blended(buttonFont, text.c_str(), buttonTextColor);
+        if (!textSurface)
+        {
+            std::cout << "Error: Unable to render text to surface" << TTF_GetError() << std::endl;
+            return false;
+        }
+
+        inputTextureWidth = textSurface->w;
+        inputTextureHeight = textSurface->h;
+        inputTexture = renderer->create_texture_from_surface(textSurface);
+        SDL_FreeSurface(textSurface);
+        if (!inputTexture)
+        {
+            std::cout << "Error: Unable to create text texture" << SDL_GetError() << std::endl;
+            return false;
+        }
+        inputTextureText = text;
+        return true;
+    }
+
+    /**
+     * @brief free the rasterised input text
+     */
+    void free_input_texture()
+    {
+        if (inputTexture && inputTextureRenderer == renderer && inputTextureGeneration == renderer->get_generation())
+        {
+            renderer->destroy_texture(inputTexture);
+        }
+        inputTexture = nullptr;
+        inputTextureText.clear();
+    }
+
 public:
     /**
      * @brief SDL input text field constructor
@@ -27,8 +120,8 @@ public:
      * was submitted. You can use this object along with a ClickableButton object to have a submit button
      * that triggers this buttons .set_clicked(true);
      *
-     * Use an SDL handle to send text input to this button if selected
-     * you can have an additional submit ClickableButton object that when clicked
+     * Use an SDL handle to send text input to this button if selected, pass masked true for password fields
+     * so the typed text is drawn as * characters. You can have an additional submit ClickableButton object that when clicked
      * you can set this button to set_clicked(true) then send the text somewher
      * e.g. a JSON string to a webserver
      *
@@ -50,12 +143,21 @@ public:
      * }
      */
     InputButton(int x, int y, int width, int height, std::string buttonLabel, Uint8 r, Uint8 g, Uint8 b, Uint8 a,
-                const std::string buttonTexturePath, TTF_Font *buttonFont, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText)
-        : BaseButton(x, y, width, height, buttonLabel, r, g, b, a, buttonTexturePath, buttonFont, redText, greenText, blueText, alphaText)
+                const std::string buttonTexturePath, TTF_Font *buttonFont, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, bool masked = false)
+        : BaseButton(x, y, width, height, buttonLabel, r, g, b, a, buttonTexturePath, buttonFont, redText, greenText, blueText, alphaText), masked(masked)
     {
         std::cout << "Constructed: Text input button: " << buttonLabel << std::endl;
     }
 
+    /**
+     * @brief free the input text texture, the label texture is freed by ~BaseButton()
+     */
+    ~InputButton()
+    {
+        free_input_texture();
+        std::cout << "Deconstructed: Text input button: " << buttonLabel << std::endl;
+    }
+
     /**
      * @brief get input text fields text
      *
@@ -104,12 +206,45 @@ public:
      */
     void remove_last_character()
     {
+        // remove the whole UTF-8 character, its continuation bytes then its lead byte
+        while (!inputText.empty() && (static_cast<unsigned char>(inputText.back()) & 0xC0) == 0x80)
+        {
+            inputText.pop_back();
+        }
         if (!inputText.empty())
         {
             inputText.pop_back();
         }
     }
 
+    /**
+     * @brief invalidate label and input text so both are rasterised again with the current font
+     */
+    void invalidate_label_texture() override
+    {
+        BaseButton::invalidate_label_texture();
+        free_input_texture();
+    }
+
+    /**
+     * @brief render the typed text centered in the button rect
+     *
+     * The whole text is rasterised by update_input_texture() only when it changes. Text wider than the
+     * button shows its end so the most recent characters stay visible
+     */
+    void render_input_text()
+    {
+        if (!update_input_texture(get_display_text()))
+        {
+            return;
+        }
+
+        int visibleWidth = std::min(inputTextureWidth, buttonRect.w);
+        SDL_Rect srcRect = {inputTextureWidth - visibleWidth, 0, visibleWidth, inputTextureHeight};
+        SDL_Rect textRect = {buttonRect.x + (buttonRect.w - visibleWidth) / 2, buttonRect.y + (buttonRect.h - inputTextureHeight) / 2, visibleWidth, inputTextureHeight};
+        renderer->copy(inputTexture, &srcRect, &textRect);
+    }
+
     /**
      * @brief render a vertical straight arrow text cursor in text input field rect
      *
@@ -135,10 +270,22 @@ public:
         SDL_Rect cursorRect = {cursorX, cursorY, cursorWidth, cursorHeight};
 
         // Set the color to black
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        renderer->set_draw_color(0, 0, 0, 255);
 
         // Render the cursor line
-        SDL_RenderFillRect(renderer, &cursorRect);
+        renderer->fill_rect(&cursorRect);
+    }
+
+    /**
+     * @brief add the typed text to the signature so typing redraws the field in the cached menu texture
+     *
+     * @return signature of the buttons current look
+     */
+    size_t get_draw_signature() const override
+    {
+        size_t signature = BaseButton::get_draw_signature();
+        hash_combine(signature, inputText);
+        return signature;
     }
 
     /**
@@ -148,21 +295,29 @@ public:
      */
     void render_button_rect() override
     {
+        record_drawn();
         if (isSelected)
         {
             // Draw yellow border
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Yellow border
+            renderer->set_draw_color(255, 255, 0, 255); // Yellow border
             SDL_Rect borderRect = {buttonRect.x - 2, buttonRect.y - 2, buttonRect.w + 4, buttonRect.h + 4};
-            SDL_RenderFillRect(renderer, &borderRect);
+            renderer->fill_rect(&borderRect);
 
             // Draw Cursor within texture
             render_cursor();
         }
 
         // Draw button
-        SDL_RenderCopy(renderer, buttonTexture, nullptr, &buttonRect);
+        renderer->copy(buttonTexture, nullptr, &buttonRect);
 
-        // Render button text as you type
-        render_button_text(buttonLabel, buttonRect, buttonTextColor);
+        // Render button text as you type, the label is shown until something is typed
+        if (inputText.empty())
+        {
+            render_button_text();
+        }
+        else
+        {
+            render_input_text();
+        }
     }
 };
@@ -46,12 +46,36 @@ public:
      */
     void set_slider_dot_texture()
     {
-        sliderDotTexture = IMG_LoadTexture(renderer, sliderDotTexturePath.c_str());
+        sliderDotTexture = renderer->load_texture(sliderDotTexturePath);
         if (!sliderDotTexture)
         {
             std::cout << "Error: Failed to load button image: " << sliderDotTexturePath << IMG_GetError() << std::endl;
         }
     }
+    /**
+     * @brief load slider dot texture without blocking on the image decode
+     *
+     * @param loader texture loader that decodes the image on a worker thread
+     */
+    void set_slider_dot_texture(TextureLoader &loader)
+    {
+        sliderDotTexture = loader.load(renderer, sliderDotTexturePath, [this](SDL_Texture *texture)
+                                       { sliderDotTexture = texture; });
+    }
+
+    /**
+     * @brief add the slider dot to the signature so dragging redraws the slider in the cached menu texture
+     *
+     * @return signature of the buttons current look
+     */
+    size_t get_draw_signature() const override
+    {
+        size_t signature = BaseButton::get_draw_signature();
+        hash_combine(signature, sliderDotRect.x);
+        hash_combine(signature, sliderDotRect.y);
+        hash_combine(signature, static_cast<const void *>(sliderDotTexture));
+        return signature;
+    }
 
     /**
      * @brief render slider button with control dot
@@ -61,22 +85,23 @@ public:
      */
     void render_button_rect() override
     {
+        record_drawn();
         // Overrides base class due to new line to draw dot
         if (isSelected)
         {
             // Draw - YELLOW border
-            SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // yellow
+            renderer->set_draw_color(255, 255, 0, 255); // yellow
             SDL_Rect borderRect = {buttonRect.x - 2, buttonRect.y - 2, buttonRect.w + 4, buttonRect.h + 4};
-            SDL_RenderFillRect(renderer, &borderRect);
+            renderer->fill_rect(&borderRect);
         }
         // Draw Button
-        SDL_RenderCopy(renderer, buttonTexture, nullptr, &buttonRect);
+        renderer->copy(buttonTexture, nullptr, &buttonRect);
 
         // Draw Dot
-        SDL_RenderCopy(renderer, sliderDotTexture, nullptr, &sliderDotRect);
+        renderer->copy(sliderDotTexture, nullptr, &sliderDotRect);
 
         // Draw text
-        render_button_text(buttonLabel, buttonRect, buttonTextColor);
+        render_button_text();
     }
 
     /**
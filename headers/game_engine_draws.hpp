@@ -40,6 +40,17 @@ void draw_timer();
  * Draw player statistics to main gamplay window e.g. health, score, skills etc.,
 */
 void draw_HUD();
+/**
+ * @brief check if an entity is inside the visible part of the game world
+ *
+ * Used by draw_entities() to cull entities outside the camera so they skip animation updates,
+ * texture lookups and rendering
+ *
+ * @param entityRect entity position and dimensions in game world coordinates
+ * @param viewRect camera position in game world coordinates with the window dimensions
+ * @return true if any part of the entity overlaps the view
+ */
+bool is_entity_visible(const SDL_Rect &entityRect, const SDL_Rect &viewRect);
 /**
  * @brief camera logic
  *
@@ -68,8 +79,48 @@ void draw_HUD();
  * and drawn at 200x ??????????????
  *
  * step 7. in draw() the player will be drawn in the middle of screen ??????
+ *
+ * step 8. entities that don't overlap the camera view (cameraRect.x/y with SCREEN_WIDTH/HEIGHT) are culled with
+ * is_entity_visible() and skip update_animation() and render_texture() entirely.
+ * entitiesDrawnCount and entitiesTotalCount are updated every frame for draw_debug_overlay()
+ *
+ * step 9. entities baked into the static layer by draw_static_layer() are skipped
+ *
+ * step 10. steps 8 and 9 happen in update() by update_render_snapshot(), draw_entities() only draws the sprites
+ * of the newest renderSnapshots snapshot and never reads entities
+ *
+ * step 11. sprites are queued in renderQueue, ordered by Entity zPos then texture when draw_scene_gameplay() submits it
+ *
+ * step 12. with 2 to 4 local players each has a split-screen view with its own camera, draw_entities() is called
+ * once per view with the viewport set to the views part of the window
+ *
+ * @param snapshot render snapshot acquired this frame
+ * @param view view whose sprites to queue
+ */
+void draw_entities(const RenderSnapshots::Snapshot &snapshot, const RenderSnapshots::View &view);
+/**
+ * @brief check if an entity belongs in the static layer
+ *
+ * @param e entity to check
+ * @return true for obstacles with a single texture e.g. mountains, trees, rivers
+ */
+bool is_static_layer_entity(Entity *e);
+/**
+ * @brief Draw the gameplay background and static obstacles
+ *
+ * The background is stretched over the window as it was before the static layer, static obstacles are baked
+ * into staticLayer chunk textures and only the chunks overlapping the camera are copied over it. If render
+ * targets aren't supported draw_entities() draws the obstacles as usual
+ *
+ * @param view view being drawn, its screen rect places the background and its camera picks the chunks
  */
-void draw_entities();
+void draw_static_layer(const RenderSnapshots::View &view);
+/**
+ * @brief Draw debug statistics to window/renderer
+ *
+ * Shown during gameplay with the settings menu FPS toggle e.g. drawn vs total entities, text cache hits/misses
+*/
+void draw_debug_overlay();
 /**
  * @brief Draw main menu to window/renderer
  * 
@@ -256,6 +307,36 @@ void draw_scene_30();
  * Draw Cutscene menu to window/renderer
 */
 void draw_scene_31();
+/**
+ * @brief Draw menu scene 1 - 31 to window/renderer
+ *
+ * Calls the matching draw_scene_x() e.g. draw_menu_scene(1) calls draw_scene_1()
+ *
+ * @param scene menu scene number
+*/
+void draw_menu_scene(int scene);
+/**
+ * @brief check if a menu scene can be drawn from menuCompositor cache
+ *
+ * Menu scenes only change on input events so they are cached, scenes showing results from
+ * background threads e.g. update check are drawn every frame
+ *
+ * @param scene scene number
+ * @return true if the scene should be drawn through menuCompositor
+*/
+bool is_menu_scene_cacheable(int scene);
+/**
+ * @brief hash everything a menu scene drawing depends on
+ *
+ * window size, language, font, menuGeneration which is increased when loaded textures are uploaded and
+ * what the scene draws outside its buttons e.g. volume text, scroll position, open dropdowns
+ * when this changes menuCompositor draws the whole scene into its cached texture again, changed buttons
+ * only redraw their own rect
+ *
+ * @param scene scene number
+ * @return signature of the scenes current state
+*/
+size_t menu_scene_signature(int scene);
 /**
  * @brief Draw HUD to window/renderer
  * 
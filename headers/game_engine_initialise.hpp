@@ -41,7 +41,7 @@ void load_buttons_to_all_buttons_vector(std::vector<BaseButton *> &allButtons);
  * then the buttons will need to draw their textures and fonts onto the new renderer
  * @param renderer the new renderer
  * */
-void initialise_button_renderer(SDL_Renderer *renderer);
+void initialise_button_renderer(RenderBackend *renderer);
 /**
  * @brief Set all buttons textures
  *
@@ -56,6 +56,13 @@ void initialise_button_textures(std::vector<BaseButton *> &allButtons);
  * which will then be used in draws() to draw the button text to GUI
  */
 void initialise_button_fonts(std::vector<BaseButton *> &allButtons);
+/**
+ * @brief Rasterise all button labels again
+ *
+ * Each button caches its label texture, call this when the language or font changes so
+ * the labels are rendered again on next draw
+ */
+void invalidate_button_label_textures(std::vector<BaseButton *> &allButtons);
 
 /**
  * @brief SDL function to load texture
@@ -67,10 +74,29 @@ void initialise_button_fonts(std::vector<BaseButton *> &allButtons);
  *
  */
 SDL_Texture *load_texture(const std::string &textureFilePath);
+/**
+ * @brief load a texture on the textureLoader worker threads
+ *
+ * texture is set to the placeholder straight away and to the loaded texture (or nullptr on failure)
+ * once upload_loaded_textures() uploads it
+ *
+ * @param textureFilePath path of the asset texture to load
+ * @param texture global texture to set e.g. background1Texture
+ */
+void load_texture_async(const std::string &textureFilePath, SDL_Texture *&texture);
+/**
+ * @brief upload textures decoded by textureLoader within its per frame budget
+ *
+ * Called once per frame by run_SDL(), when textures replace their placeholders the cached menu scenes, static
+ * layer and entity animation textures are refreshed. Runs before update() so the static layer is invalidated
+ * before update_render_snapshot() decides which entities it bakes and publishes the frame
+ */
+void upload_loaded_textures();
 /**
  * @brief SDL function to load sound
  *
- * uses SDL_Mixer to load sounds from c style filepath
+ * uses SDL_Mixer to load sounds from c style filepath through soundBank, a file already loaded e.g. by an
+ * entity is shared instead of decoded again
  *
  * @param sfxFilePath path of the asset texture to load
  * @return a Mix_Chunk *sound object to then play in audio channel
@@ -98,8 +124,8 @@ void load_controllers();
 /**
  * @brief SDL function to initialise textures
  *
- * uses SDL_texture to load a bunch of filepaths into load_texture() to then render to GUI
- * at a later stage
+ * uses load_texture_async() to decode a bunch of filepaths on worker threads to then render to GUI
+ * at a later stage, the placeholder texture is drawn until each one is uploaded
  *
  *
  */
@@ -116,7 +142,9 @@ void load_sounds();
 /**
  * @brief SDL function to initialise music files
  *
- * uses SDL_mixer to accept parameter of a audio file sound path to play that music
+ * uses SDL_mixer to accept parameter of a audio file sound path to play that music, through musicManager so
+ * the file is opened on the music thread and faded in. The track already playing keeps playing, scenes that
+ * share a track don't reload it
  *
  * @param songTitle accepts a string filepath of music to play
  */
@@ -141,6 +169,9 @@ void set_font(const std::string &language);
  * Accepts a text string with styling parameters to write to window to show messages/label in GUI.
  * Uses SDL framework and traditionally loaded with TTF_Font *load_font() which returns a TTF_Font *font object
  *
+ * Rendered textures are kept in textCache keyed by (text, font, color) so a string is only rasterised
+ * the first time it's drawn, least recently used textures are destroyed when over budget
+ *
  * EXAMPLE
  *
  * The below will draw a solid black "Hello World" message in the top left of window
@@ -158,6 +189,18 @@ void set_font(const std::string &language);
  * @param font the passed SDL_ttf font object
  */
 void render_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
+/**
+ * @brief render frequently changing text to window
+ *
+ * Same parameters as render_text() but drawn with glyphAtlas, each glyph is rasterised once and
+ * strings are drawn as batched quads so text that changes every frame e.g. "FPS: 60", timers and scores
+ * doesn't rasterise a new texture per change. Falls back to render_text() for scripts that need shaping
+ *
+ * EXAMPLE
+ *
+ * render_dynamic_text("Score: " + std::to_string(score), (SCREEN_WIDTH * 0.4), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
+ */
+void render_dynamic_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
 /**
  * @brief SDL and Asset initialisations
  *
@@ -180,8 +223,31 @@ void start_SDL();
  * @brief SDL event loop initialisation
  *
  * Calls the functions to run in an SDL event loop until manually closed by user
+ *
+ * On static menu scenes the loop sleeps in SDL_WaitEventTimeout() until an event arrives or idleWaitTimeout ms pass,
+ * while the window is minimised or unfocused menu scene frames are capped to backgroundFrameCap FPS, gameplay keeps
+ * its full tick rate so it stays in step with other players
  */
 void run_SDL();
+/**
+ * @brief wake run_SDL() if it's waiting for events
+ *
+ * Safe to call from other threads e.g. timer or network threads that change what's drawn
+ *
+ * EXAMPLE
+ *
+ * countdownSeconds--;
+ * wake_event_loop();
+ */
+void wake_event_loop();
+/**
+ * @brief match particleBudget's frame budget to the refresh rate of the display the window is on
+ *
+ * vsync holds every frame for a whole refresh interval, a fixed budget would thin particles all the time on a
+ * display slower than it assumes and never on a faster one. Frames are allowed 20% over the refresh interval
+ * e.g. 20ms at 60Hz, the budget is kept if the refresh rate is unknown e.g. headless
+ */
+void set_particle_frame_budget();
 /**
  * @brief SDL exit initialisation
  *
@@ -225,5 +291,6 @@ void update(int &soundVolume, int &musicVolume, int &scene, bool gamePaused);
  * Buttons constructed from your BaseButton.hpp
  * Images loaded from load_texture()
  * You can use draw SDL_Rect's, or anything to renderer to appear here
+ * Where RenderThread::is_supported() the draws are only recorded here, renderThread rasterises and presents them on its own thread
  */
-void draw(SDL_Renderer *&renderer, int &scene, SDL_Texture *&background1Texture, float fps, bool gamePaused);
\ No newline at end of file
+void draw(RenderBackend *renderer, int &scene, SDL_Texture *&background1Texture, float fps, bool gamePaused);
\ No newline at end of file
@@ -30,7 +30,7 @@
 * void draw_timer()
 * {
 *     SDL_Rect timerRect = {static_cast<int>(SCREEN_WIDTH * 0.05), static_cast<int>(SCREEN_HEIGHT * 0.03), (SCREEN_WIDTH / 5), (SCREEN_HEIGHT / 8)};
-*     SDL_RenderCopy(renderer, timerTexture, nullptr, &timerRect);
+*     renderer->copy(timerTexture, nullptr, &timerRect);
 *
 *     int minutes = countdownSeconds / 60;
 *     int seconds = countdownSeconds % 60;
@@ -129,12 +129,19 @@ std::string find_os();
  * Pass a filename which will then output the text contents to screen for user
  * to read contents
  *
+ * The file is only read once by documentViewer and word wrapped to the window width, only lines
+ * visible at the current scrollYpos are drawn and each line is rasterised once when it scrolls into view
+ *
  * @param fileToOutput the filename to read and output to screen
  */
 void draw_file_contents_to_screen(const std::string &fileToOutput);
 /**
  * @brief Game Map | Minimap
  * https://lazyfoo.net/tutorials/SDL/09_the_viewport/index.php
+ *
+ * Draws the whole game world MINIMAP_SIZE wide in the bottom right corner. The background and static obstacles
+ * are drawn once into the minimap texture and again only when staticLayer's revision changes. Markers for players,
+ * bots, enemies and items near the camera are looked up in spatialGrid and refreshed at 10Hz by minimap
  */
 void draw_minimap();
 /**
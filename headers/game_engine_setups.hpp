@@ -18,6 +18,13 @@
  * and spawn the player in the middle always, this prevents any collission with collision checks.
 */
 void setup_entities_positions(std::vector<Entity *> &entities);
+/**
+ * @brief when game scene/level starts this function loads every entities animation clip and collision sound
+ *
+ * Entities with the same textures share one clip in animationClips, draw_entities() then only picks
+ * the current frame from the shared animation clock. Entities with the same sound share one soundBank sound.
+*/
+void setup_entity_assets(std::vector<Entity *> &entities);
 /**
  * @brief when game scene/level starts this function sets all scene/level variables
  * 
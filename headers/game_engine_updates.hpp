@@ -85,3 +85,53 @@ void update_scene_28();
  * @brief continous loop logic for this scene
 */
 void update_scene_gameplay();
+/**
+ * @brief move particles and cull the ones outside every view of the snapshot
+ *
+ * Particles are kept inside the union of the views cameras, split-screen views far apart keep the particles
+ * between them too, there's one pool for every view
+ *
+ * @param snapshot snapshot being written by update_render_snapshot() with all its views added
+*/
+void update_particles(const RenderSnapshots::Snapshot &snapshot);
+/**
+ * @brief hear positional sounds from the camera centre of every view of the snapshot
+ *
+ * voiceManager pans and attenuates each play_at() sound against the nearest views camera, so a split-screen
+ * players collisions are heard from their own view. Sounds of the next update use these listeners
+ *
+ * @param snapshot snapshot being written by update_render_snapshot() with all its views added
+*/
+void update_sound_listeners(const RenderSnapshots::Snapshot &snapshot);
+/**
+ * @brief publish the entities draw() should show this tick into renderSnapshots
+ *
+ * Culls entities outside the camera with spatialGrid.query() and static layer entities, advances the shared
+ * animation clock and writes each remaining entities current texture and screen rect, so draw_entities() never
+ * reads entities. Called at the end of update_scene_gameplay() once entities and the camera have moved and
+ * spatialGrid was rebuilt
+ *
+ * Particles aren't copied into the snapshot, update_particles() moves and culls the live pool once the views
+ * are known and draw_scene_gameplay() draws that pool per view
+ *
+ * @param players players found while moving entities this tick, the client player is always drawn
+*/
+void update_render_snapshot(const std::vector<Player *> &players);
+/**
+ * @brief get the window region of a split-screen view
+ *
+ * @param index view index, 0 to viewCount - 1
+ * @param viewCount number of views, 1 is the whole window, 2 side by side halves, 3 or 4 quarters
+ * @return screen rect of the view
+*/
+SDL_Rect get_split_screen_rect(int index, int viewCount);
+/**
+ * @brief add a view per local player to the snapshot with its own camera
+ *
+ * Each view culls with spatialGrid.query() around its camera, so four views cost about the entities on
+ * screen not four passes over the whole world. All views write into the snapshots shared sprite list
+ *
+ * @param snapshot snapshot being written by update_render_snapshot()
+ * @param localPlayers 2 to 4 players playing on this machine
+*/
+void update_split_screen_views(RenderSnapshots::Snapshot &snapshot, const std::vector<Player *> &localPlayers);
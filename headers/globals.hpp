@@ -42,6 +42,24 @@
 #include "entities/Obstacle.hpp"
 #include "UpdateApp.hpp"
 #include "DebugLogging.hpp"
+#include "TextureLoader.hpp"
+#include "AnimationClips.hpp"
+#include "AudioDevice.hpp"
+#include "SoundBank.hpp"
+#include "VoiceManager.hpp"
+#include "MusicManager.hpp"
+#include "TextCache.hpp"
+#include "GlyphAtlas.hpp"
+#include "DocumentViewer.hpp"
+#include "MenuCompositor.hpp"
+#include "StaticLayer.hpp"
+#include "SpatialGrid.hpp"
+#include "Minimap.hpp"
+#include "RenderSnapshots.hpp"
+#include "HeadlessRenderer.hpp"
+#include "WindowRenderer.hpp"
+#include "RenderThread.hpp"
+#include "RenderQueue.hpp"
 #include "WebserverHost.hpp"
 #include "WebserverClient.hpp"
 #include "ParticleGenerator.hpp"
@@ -51,7 +69,7 @@
 
 // Standard SDL Library
 extern SDL_Window *window;
-extern SDL_Renderer *renderer;
+extern RenderBackend *renderer;
 
 // Textures
 extern SDL_Texture *background1Texture;
@@ -122,7 +140,11 @@ extern TTF_Font *geezBoldfont36;
 extern TTF_Font *geezBoldfont48;
 
 // SDL_Mixer
-extern Mix_Music *music;
+extern AudioDevice audioDevice;
+extern AudioDevice::Profile audioProfile;
+extern SoundBank soundBank;
+extern VoiceManager voiceManager;
+extern MusicManager musicManager;
 extern Mix_Chunk *treeSound;
 extern Mix_Chunk *waterSound;
 extern Mix_Chunk *barkSound;
@@ -169,6 +191,8 @@ extern int SCREEN_WIDTH;
 extern int SCREEN_HEIGHT;
 extern int MINIMAP_SIZE;
 extern SDL_Rect cameraRect;
+extern int entitiesDrawnCount;
+extern int entitiesTotalCount;
 extern std::string currentResolution;
 extern float acceleration;
 extern float deceleration;
@@ -202,6 +226,13 @@ extern bool displayOnScreenKeys;
 extern bool displayFPS;
 extern bool windowResized;
 extern bool windowMinimized;
+extern unsigned int menuGeneration;
+extern bool windowFocused;
+extern int backgroundFrameCap;
+extern int idleWaitTimeout;
+extern Uint32 wakeEventType;
+extern bool headlessMode;
+extern int headlessTickLimit;
 extern bool isMultiplayerGame; // flag for indicating game is multiplayer to POST gameplay to webserver host
 extern int clientPlayerID;
 extern std::mt19937 gen; // for bot simulation
@@ -229,7 +260,8 @@ extern std::map< std::string, std::map< std::string, std::string>> languageTrans
 
 extern std::vector<Entity *> entities;
 
-extern std::vector<ParticleGenerator> particles;
+extern ParticleBudget particleBudget;
+extern ParticleGenerator particles;
 
 extern BaseButton *selectedButton;
 
@@ -415,5 +447,19 @@ extern std::vector<BaseButton *> sceneGameplaybuttons;
 extern std::vector<Score> scores;
 extern UpdateApp updateApp;
 extern DebugLogging logger;
+extern TextureLoader textureLoader;
+extern AnimationClips animationClips;
+extern TextCache textCache;
+extern GlyphAtlas glyphAtlas;
+extern DocumentViewer documentViewer;
+extern MenuCompositor menuCompositor;
+extern StaticLayer staticLayer;
+extern SpatialGrid spatialGrid;
+extern Minimap minimap;
+extern RenderSnapshots renderSnapshots;
+extern RenderThread renderThread;
+extern WindowRenderer windowRenderer;
+extern HeadlessRenderer headlessRenderer;
+extern RenderQueue renderQueue;
 extern WebserverClient webserverClientContext;
 extern WebserverHost webserverHostContext;
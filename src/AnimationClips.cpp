@@ -0,0 +1,142 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::max
+#include "../headers/AnimationClips.hpp"
+
+AnimationClips::AnimationClips(TextureLoader &loader) : loader(loader)
+{
+    std::cout << "Constructed: AnimationClips" << std::endl;
+}
+
+AnimationClips::~AnimationClips()
+{
+    std::cout << "Deconstructed: AnimationClips" << std::endl;
+}
+
+int AnimationClips::load_frame(RenderBackend *renderer, const std::string &filePath)
+{
+    auto found = frameIds.find(filePath);
+    if (found != frameIds.end())
+    {
+        return found->second;
+    }
+
+    int frameId = static_cast<int>(frameTextures.size());
+    frameTextures.push_back(nullptr);
+    frameLoaded.push_back(false);
+    framePaths.push_back(filePath);
+    frameIds[filePath] = frameId;
+    request_frame(renderer, frameId);
+    return frameId;
+}
+
+void AnimationClips::request_frame(RenderBackend *renderer, int frameId)
+{
+    this->renderer = renderer;
+    unsigned int requestGeneration = generation;
+    frameTextures[frameId] = loader.load(renderer, framePaths[frameId], [this, frameId, requestGeneration](SDL_Texture *texture)
+    {
+        if (requestGeneration != generation)
+        {
+            // clips were cleared while this frame was loading
+            if (texture)
+            {
+                this->renderer->destroy_texture(texture);
+            }
+            return;
+        }
+        if (frameLoaded[frameId] && frameTextures[frameId])
+        {
+            this->renderer->destroy_texture(frameTextures[frameId]);
+        }
+        frameTextures[frameId] = texture;
+        frameLoaded[frameId] = true;
+    });
+    frameLoaded[frameId] = false;
+}
+
+int AnimationClips::load_clip(RenderBackend *renderer, const std::vector<std::string> &paths, Uint32 frameDuration)
+{
+    if (paths.empty())
+    {
+        return -1;
+    }
+
+    std::string key = std::to_string(frameDuration);
+    for (const std::string &path : paths)
+    {
+        key += '\n' + path;
+    }
+    auto found = clipIds.find(key);
+    if (found != clipIds.end())
+    {
+        return found->second;
+    }
+
+    Clip clip{};
+    clip.frameDuration = std::max<Uint32>(1, frameDuration);
+    for (const std::string &path : paths)
+    {
+        clip.frames.push_back(load_frame(renderer, path));
+    }
+    int clipId = static_cast<int>(clips.size());
+    clips.push_back(clip);
+    clipIds[key] = clipId;
+    return clipId;
+}
+
+void AnimationClips::advance(Uint32 ticks)
+{
+    clock = ticks;
+}
+
+SDL_Texture *AnimationClips::get_frame(int clipId, Uint32 phase) const
+{
+    if (clipId < 0 || clipId >= static_cast<int>(clips.size()))
+    {
+        return nullptr;
+    }
+    const Clip &clip = clips[clipId];
+    size_t frame = ((clock + phase) / clip.frameDuration) % clip.frames.size();
+    return frameTextures[clip.frames[frame]];
+}
+
+void AnimationClips::clear_textures()
+{
+    for (size_t i = 0; i < frameTextures.size(); i++)
+    {
+        if (frameLoaded[i] && frameTextures[i])
+        {
+            renderer->destroy_texture(frameTextures[i]);
+        }
+        frameTextures[i] = nullptr; // placeholders belong to the loader
+    }
+}
+
+void AnimationClips::reload_textures(RenderBackend *renderer)
+{
+    clear_textures();
+    for (size_t i = 0; i < frameTextures.size(); i++)
+    {
+        request_frame(renderer, static_cast<int>(i));
+    }
+}
+
+void AnimationClips::clear()
+{
+    clear_textures();
+    generation++;
+    frameTextures.clear();
+    frameLoaded.clear();
+    framePaths.clear();
+    frameIds.clear();
+    clips.clear();
+    clipIds.clear();
+}
@@ -0,0 +1,159 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::min
+#include "../headers/AudioDevice.hpp"
+#include "../headers/globals.hpp" // logger
+
+AudioDevice::AudioDevice(int frequency, int channels) : requestedFrequency(frequency), requestedChannels(channels)
+{
+    std::cout << "Constructed: AudioDevice" << std::endl;
+}
+
+AudioDevice::~AudioDevice()
+{
+    std::cout << "Deconstructed: AudioDevice" << std::endl;
+}
+
+void AudioDevice::post_mix(void *device, Uint8 *, int length)
+{
+    AudioDevice *self = static_cast<AudioDevice *>(device);
+    Uint64 now = SDL_GetPerformanceCounter();
+    unsigned int count = self->callbacks.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (self->lastCallback != 0 && count > WARMUP_CALLBACKS && self->bytesPerFrame > 0)
+    {
+        // the device asks for the next buffer when the last one is nearly played, much later means it ran dry
+        double bufferDuration = static_cast<double>(length / self->bytesPerFrame) / self->frequency;
+        double sinceLast = static_cast<double>(now - self->lastCallback) / static_cast<double>(self->counterFrequency);
+        if (sinceLast > bufferDuration * 2.0)
+        {
+            self->underruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    self->lastCallback = now;
+}
+
+bool AudioDevice::open_device()
+{
+    if (Mix_OpenAudio(requestedFrequency, MIX_DEFAULT_FORMAT, requestedChannels, bufferFrames) == -1)
+    {
+        logger.log_critical("Error: Failed to open audio device: " + std::string(Mix_GetError()));
+        opened = false;
+        return false;
+    }
+
+    // the device may not give the exact format asked for
+    Uint16 format{};
+    int channels{};
+    Mix_QuerySpec(&frequency, &format, &channels);
+    bytesPerFrame = (format & 0xFF) / 8 * channels;
+    counterFrequency = SDL_GetPerformanceFrequency();
+    underruns.store(0);
+    callbacks.store(0);
+    lastCallback = 0;
+    opened = true;
+    Mix_SetPostMix(&AudioDevice::post_mix, this);
+    return true;
+}
+
+void AudioDevice::close_device()
+{
+    if (!opened)
+    {
+        return;
+    }
+    Mix_SetPostMix(nullptr, nullptr);
+    Mix_CloseAudio();
+    previousUnderruns += underruns.load();
+    opened = false;
+}
+
+bool AudioDevice::open(Profile profile)
+{
+    close_device();
+    this->profile = profile;
+    if (profile == Profile::LOW_LATENCY)
+    {
+        bufferFrames = LOW_LATENCY_FRAMES;
+        maxBufferFrames = LOW_LATENCY_MAX_FRAMES;
+    }
+    else
+    {
+        bufferFrames = STANDARD_FRAMES;
+        maxBufferFrames = STANDARD_FRAMES;
+    }
+    windowStart = 0;
+    windowUnderruns = 0;
+    return open_device();
+}
+
+void AudioDevice::close()
+{
+    close_device();
+}
+
+bool AudioDevice::needs_larger_buffer(Uint32 ticks)
+{
+    if (!opened)
+    {
+        return false;
+    }
+    unsigned int count = underruns.load(std::memory_order_relaxed);
+    if (ticks - windowStart >= UNDERRUN_WINDOW)
+    {
+        windowStart = ticks;
+        windowUnderruns = count;
+        return false;
+    }
+    return count - windowUnderruns >= UNDERRUNS_TO_GROW && bufferFrames < maxBufferFrames;
+}
+
+bool AudioDevice::grow_buffer(Uint32 ticks)
+{
+    if (!opened || bufferFrames >= maxBufferFrames)
+    {
+        return false;
+    }
+    int previousFrames = bufferFrames;
+    close_device();
+    bufferFrames = std::min(bufferFrames * 2, maxBufferFrames);
+    logger.log_non_critical("Audio buffer underruns, growing buffer from " + std::to_string(previousFrames) + " to " + std::to_string(bufferFrames) + " frames");
+    if (!open_device())
+    {
+        bufferFrames = previousFrames; // keep going with the smaller buffer rather than no audio
+        open_device();
+    }
+    windowStart = ticks;
+    windowUnderruns = 0;
+    return opened;
+}
+
+bool AudioDevice::is_open() const
+{
+    return opened;
+}
+
+int AudioDevice::get_buffer_frames() const
+{
+    return bufferFrames;
+}
+
+float AudioDevice::get_latency() const
+{
+    if (!opened || frequency == 0)
+    {
+        return 0.0f;
+    }
+    return static_cast<float>(bufferFrames) * 1000.0f / static_cast<float>(frequency);
+}
+
+unsigned int AudioDevice::get_underrun_count() const
+{
+    return previousUnderruns + underruns.load(std::memory_order_relaxed);
+}
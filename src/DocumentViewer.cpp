@@ -0,0 +1,229 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <fstream>
+#include <algorithm> // for std::max/min
+#include "../headers/DocumentViewer.hpp"
+#include "../headers/globals.hpp" // logger
+
+DocumentViewer::DocumentViewer()
+{
+    std::cout << "Constructed: DocumentViewer" << std::endl;
+}
+
+DocumentViewer::~DocumentViewer()
+{
+    std::cout << "Deconstructed: DocumentViewer" << std::endl;
+}
+
+DocumentViewer::Document &DocumentViewer::load_document(const std::string &filePath)
+{
+    auto found = documents.find(filePath);
+    if (found != documents.end())
+    {
+        return found->second;
+    }
+
+    Document &document = documents[filePath];
+    std::ifstream documentFile(filePath);
+    if (!documentFile.is_open())
+    {
+        logger.log_critical("Error: Failed to open: " + filePath);
+        return document;
+    }
+
+    std::string line;
+    while (std::getline(documentFile, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back(); // windows line endings
+        }
+        document.paragraphs.push_back(line);
+    }
+    document.loaded = true;
+    return document;
+}
+
+std::vector<std::string> DocumentViewer::wrap_text(const std::string &text, TTF_Font *font, int width)
+{
+    std::vector<std::string> lines{};
+    std::string currentLine{};
+    int textWidth{}, textHeight{};
+
+    auto fits = [&](const std::string &candidate)
+    {
+        TTF_SizeUTF8(font, candidate.c_str(), &textWidth, &textHeight);
+        return textWidth <= width;
+    };
+
+    size_t i = 0;
+    while (i < text.size())
+    {
+        // take the next word including its leading spaces
+        size_t wordEnd = text.find(' ', text.find_first_not_of(' ', i));
+        if (wordEnd == std::string::npos)
+        {
+            wordEnd = text.size();
+        }
+        std::string word = text.substr(i, wordEnd - i);
+        i = wordEnd;
+
+        if (fits(currentLine + word))
+        {
+            currentLine += word;
+            continue;
+        }
+        if (!currentLine.empty())
+        {
+            lines.push_back(currentLine);
+            currentLine.clear();
+            word.erase(0, word.find_first_not_of(' ')); // don't start the next line with spaces
+        }
+
+        // word is wider than a whole line so break it between UTF-8 characters
+        while (!word.empty() && !fits(word))
+        {
+            size_t split = 0;
+            size_t next = 0;
+            while (next < word.size())
+            {
+                size_t length = 1;
+                while (next + length < word.size() && (static_cast<unsigned char>(word[next + length]) & 0xC0) == 0x80)
+                {
+                    length++;
+                }
+                if (!fits(word.substr(0, next + length)))
+                {
+                    break;
+                }
+                next += length;
+                split = next;
+            }
+            if (split == 0)
+            {
+                // not even one character fits, take it anyway to avoid looping forever
+                split = 1;
+                while (split < word.size() && (static_cast<unsigned char>(word[split]) & 0xC0) == 0x80)
+                {
+                    split++;
+                }
+            }
+            lines.push_back(word.substr(0, split));
+            word.erase(0, split);
+        }
+        currentLine = word;
+    }
+    lines.push_back(currentLine);
+    return lines;
+}
+
+void DocumentViewer::wrap_document(Document &document, TTF_Font *font, int width)
+{
+    destroy_line_textures(document);
+    document.lines.clear();
+    for (const std::string &paragraph : document.paragraphs)
+    {
+        std::vector<std::string> wrapped = wrap_text(paragraph, font, width);
+        document.lines.insert(document.lines.end(), wrapped.begin(), wrapped.end());
+    }
+    document.wrapFont = font;
+    document.wrapWidth = width;
+    document.lineHeight = std::max(1, TTF_FontLineSkip(font));
+}
+
+void DocumentViewer::destroy_line_textures(Document &document)
+{
+    for (auto &pair : document.textures)
+    {
+        renderer->destroy_texture(pair.second.texture);
+    }
+    document.textures.clear();
+}
+
+bool DocumentViewer::draw(RenderBackend *renderer, const std::string &filePath, const SDL_Rect &area, int scrollY, TTF_Font *font, SDL_Color color)
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::TEXT);
+    if (font == nullptr)
+    {
+        return false;
+    }
+    Document &document = load_document(filePath);
+    if (!document.loaded)
+    {
+        return false;
+    }
+    if (document.wrapFont != font || document.wrapWidth != area.w)
+    {
+        wrap_document(document, font, area.w);
+    }
+    if (document.textureColor.r != color.r || document.textureColor.g != color.g || document.textureColor.b != color.b || document.textureColor.a != color.a)
+    {
+        destroy_line_textures(document);
+        document.textureColor = color;
+    }
+
+    // only the line indexes that overlap the visible area are looked at
+    int top = area.y + scrollY;
+    int firstLine = std::max(0, -top / document.lineHeight);
+    int lastLine = std::min(static_cast<int>(document.lines.size()) - 1, (area.y + area.h - top) / document.lineHeight);
+
+    for (int i = firstLine; i <= lastLine; i++)
+    {
+        const std::string &line = document.lines[i];
+        if (line.empty())
+        {
+            continue;
+        }
+        auto found = document.textures.find(i);
+        if (found == document.textures.end())
+        {
+            // newly exposed line
+            LineTexture lineTexture{};
+            SDL_Surface *lineSurface = TTF_RenderUTF8_Blended(font, line.c_str(), color);
+            if (lineSurface)
+            {
+                lineTexture.width = lineSurface->w;
+                lineTexture.height = lineSurface->h;
+                lineTexture.texture = renderer->create_texture_from_surface(lineSurface);
+                SDL_FreeSurface(lineSurface);
+            }
+            found = document.textures.emplace(i, lineTexture).first;
+        }
+        if (found->second.texture)
+        {
+            SDL_Rect lineRect = {area.x, top + i * document.lineHeight, found->second.width, found->second.height};
+            renderer->copy(found->second.texture, nullptr, &lineRect);
+        }
+    }
+
+    // free lines that have scrolled far out of view
+    for (auto it = document.textures.begin(); it != document.textures.end();)
+    {
+        int index = static_cast<int>(it->first);
+        if (index < firstLine - cachedLinesMargin || index > lastLine + cachedLinesMargin)
+        {
+            renderer->destroy_texture(it->second.texture);
+            it = document.textures.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return true;
+}
+
+void DocumentViewer::clear_textures()
+{
+    for (auto &pair : documents)
+    {
+        destroy_line_textures(pair.second);
+    }
+}
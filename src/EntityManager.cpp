@@ -18,7 +18,7 @@ EntityManager::~EntityManager()
     std::cout << "Destroyed: EntityManager" << std::endl;
 }
 
-void EntityManager::create_player_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int playerCount)
+void EntityManager::create_player_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int playerCount)
 {
     if (playerCount >= 5) {
         playerCount = 4; // limit to max 4 players if function overloaded with playerCount greater then 5 players
@@ -79,7 +79,6 @@ void EntityManager::create_player_entity(SDL_Renderer *renderer, std::vector<Ent
         }
         Player *player = new Player(playerID, name, x, y, width, height, health, collisionSoundString, defaultTextures);
         player->set_renderer(renderer);
-        player->set_sound();
         entities.push_back(player);
     }
     int totalPlayers{};
@@ -92,7 +91,7 @@ void EntityManager::create_player_entity(SDL_Renderer *renderer, std::vector<Ent
     }
     std::cout << "Total players are: " << totalPlayers << std::endl;
 }
-void EntityManager::create_bot_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int botCount)
+void EntityManager::create_bot_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int botCount)
 {
     if (botCount >= 5) {
         botCount = 4; // limit to max 4 players if function overloaded with playerCount greater then 5 players
@@ -158,7 +157,6 @@ void EntityManager::create_bot_entity(SDL_Renderer *renderer, std::vector<Entity
         }
         Bot *bot = new Bot(playerID, name, x, y, width, height, health, collisionSoundString, defaultTextures);
         bot->set_renderer(renderer);
-        bot->set_sound();
         entities.push_back(bot);
     }
     int totalPlayers{};
@@ -178,7 +176,7 @@ void EntityManager::create_bot_entity(SDL_Renderer *renderer, std::vector<Entity
     std::cout << "Total players: " << totalPlayers << "Total bots: " << totalBots<< std::endl;
 }
 
-void EntityManager::create_item_heart_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
+void EntityManager::create_item_heart_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
 {
     std::string name = "Heart";
     std::string textureFilePath = "assets/graphics/kenney_pixel-platformer/Tiles/Characters/tile_0044.png";
@@ -194,10 +192,9 @@ void EntityManager::create_item_heart_entity(SDL_Renderer *renderer, std::vector
 
     Heart *item = new Heart(name, x, y, width, height, health, collisionSoundString, defaultTextures);
     item->set_renderer(renderer);
-    item->set_sound();
     entities.push_back(item);
 }
-void EntityManager::create_random_item_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
+void EntityManager::create_random_item_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
 {
     // Creation logic for item entities
     std::random_device rd;
@@ -222,7 +219,6 @@ void EntityManager::create_random_item_entity(SDL_Renderer *renderer, std::vecto
         };
         Heart *item = new Heart(name, x, y, width, height, health, collisionSoundString, heartsDefaultTextures);
         item->set_renderer(renderer);
-        item->set_sound();
         entities.push_back(item);
     }
     else if (random == 1)
@@ -235,7 +231,6 @@ void EntityManager::create_random_item_entity(SDL_Renderer *renderer, std::vecto
         };
         Boots *item = new Boots(name, x, y, width, height, health, collisionSoundString, bootsDefaultTextures);
         item->set_renderer(renderer);
-        item->set_sound();
         entities.push_back(item);
     }
     else if (random == 2)
@@ -248,7 +243,6 @@ void EntityManager::create_random_item_entity(SDL_Renderer *renderer, std::vecto
         };
         Gem *item = new Gem(name, x, y, width, height, health, collisionSoundString, gemDefaultTextures);
         item->set_renderer(renderer);
-        item->set_sound();
         entities.push_back(item);
     }
     else if (random == 3)
@@ -261,7 +255,6 @@ void EntityManager::create_random_item_entity(SDL_Renderer *renderer, std::vecto
         };
         Ammo *item = new Ammo(name, x, y, width, height, health, collisionSoundString, ammoDefaultTextures);
         item->set_renderer(renderer);
-        item->set_sound();
         entities.push_back(item);
     }
     else
@@ -274,11 +267,10 @@ void EntityManager::create_random_item_entity(SDL_Renderer *renderer, std::vecto
         };
         Key *item = new Key(name, x, y, width, height, health, collisionSoundString, keyDefaultTextures);
         item->set_renderer(renderer);
-        item->set_sound();
         entities.push_back(item);
     }
 }
-void EntityManager::create_random_enemy_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
+void EntityManager::create_random_enemy_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
 {
     // Creation logic for enemy entities
     std::random_device rd;
@@ -303,7 +295,6 @@ void EntityManager::create_random_enemy_entity(SDL_Renderer *renderer, std::vect
         };
         Bomb *enemy = new Bomb(name, x, y, width, height, health, collisionSoundString, bombDefaultTextures);
         enemy->set_renderer(renderer);
-        enemy->set_sound();
         entities.push_back(enemy);
     }
     else
@@ -317,11 +308,10 @@ void EntityManager::create_random_enemy_entity(SDL_Renderer *renderer, std::vect
         };
         Robot *enemy = new Robot(name, x, y, width, height, health, collisionSoundString, robotDefaultTextures);
         enemy->set_renderer(renderer);
-        enemy->set_sound();
         entities.push_back(enemy);
     }
 }
-void EntityManager::create_random_obstacle_entity(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
+void EntityManager::create_random_obstacle_entity(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT)
 {
     // Creation logic for obstacle entities
     std::random_device rd;
@@ -346,7 +336,6 @@ void EntityManager::create_random_obstacle_entity(SDL_Renderer *renderer, std::v
         };
         Mountain *obstacle = new Mountain(name, x, y, width, height, health, collisionSoundString, mountainDefaultTextures);
         obstacle->set_renderer(renderer);
-        obstacle->set_sound();
         entities.push_back(obstacle);
     }
     else if (random == 1)
@@ -359,7 +348,6 @@ void EntityManager::create_random_obstacle_entity(SDL_Renderer *renderer, std::v
         };
         Tree *obstacle = new Tree(name, x, y, width, height, health, collisionSoundString, treeDefaultTextures);
         obstacle->set_renderer(renderer);
-        obstacle->set_sound();
         entities.push_back(obstacle);
     }
     else
@@ -372,11 +360,10 @@ void EntityManager::create_random_obstacle_entity(SDL_Renderer *renderer, std::v
         };
         River *obstacle = new River(name, x, y, width, height, health, collisionSoundString, riverDefaultTextures);
         obstacle->set_renderer(renderer);
-        obstacle->set_sound();
         entities.push_back(obstacle);
     }
 }
-void EntityManager::random_procedural_generation(SDL_Renderer *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int itemsCount, int enemiesCount, int obstaclesCount)
+void EntityManager::random_procedural_generation(RenderBackend *renderer, std::vector<Entity *> &entities, int SCREEN_WIDTH, int SCREEN_HEIGHT, int itemsCount, int enemiesCount, int obstaclesCount)
 {
     // Clear existing entities vector for setting up new scene
     for (size_t i = 0; i < entities.size(); i++)
@@ -436,10 +423,5 @@ void EntityManager::random_procedural_generation(SDL_Renderer *renderer, std::ve
         }
     }
 
-    for (Entity *e : entities)
-    {
-        e->preload_textures();
-    }
-
     std::cout << "END: total entities after procedural generation: " << entities.size() << std::endl;
 }
@@ -0,0 +1,267 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::max
+#include "../headers/GlyphAtlas.hpp"
+
+GlyphAtlas::GlyphAtlas()
+{
+    std::cout << "Constructed: GlyphAtlas" << std::endl;
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    std::cout << "Deconstructed: GlyphAtlas" << std::endl;
+}
+
+std::vector<Uint32> GlyphAtlas::decode_utf8(const std::string &text)
+{
+    std::vector<Uint32> codepoints{};
+    codepoints.reserve(text.size());
+
+    size_t i = 0;
+    while (i < text.size())
+    {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        Uint32 codepoint{};
+        int length{};
+        if (c < 0x80)
+        {
+            codepoint = c;
+            length = 1;
+        }
+        else if ((c & 0xE0) == 0xC0)
+        {
+            codepoint = c & 0x1F;
+            length = 2;
+        }
+        else if ((c & 0xF0) == 0xE0)
+        {
+            codepoint = c & 0x0F;
+            length = 3;
+        }
+        else if ((c & 0xF8) == 0xF0)
+        {
+            codepoint = c & 0x07;
+            length = 4;
+        }
+        else
+        {
+            codepoints.push_back(0xFFFD);
+            i++;
+            continue;
+        }
+
+        if (i + length > text.size())
+        {
+            codepoints.push_back(0xFFFD);
+            break;
+        }
+        bool valid = true;
+        for (int j = 1; j < length; j++)
+        {
+            unsigned char continuation = static_cast<unsigned char>(text[i + j]);
+            if ((continuation & 0xC0) != 0x80)
+            {
+                valid = false;
+                break;
+            }
+            codepoint = (codepoint << 6) | (continuation & 0x3F);
+        }
+        if (!valid)
+        {
+            codepoints.push_back(0xFFFD);
+            i++;
+            continue;
+        }
+        codepoints.push_back(codepoint);
+        i += length;
+    }
+    return codepoints;
+}
+
+bool GlyphAtlas::needs_shaping(Uint32 codepoint)
+{
+    return (codepoint >= 0x0600 && codepoint <= 0x08FF) || // Arabic, Syriac, Thaana, Arabic supplements
+           (codepoint >= 0x0900 && codepoint <= 0x0DFF) || // Devanagari and other Indic scripts
+           (codepoint >= 0x0E00 && codepoint <= 0x0E7F) || // Thai
+           (codepoint >= 0xFB50 && codepoint <= 0xFEFF);   // Arabic presentation forms
+}
+
+const GlyphAtlas::Glyph *GlyphAtlas::find_or_add_glyph(RenderBackend *renderer, TTF_Font *font, FontAtlas &atlas, Uint32 codepoint)
+{
+    auto found = atlas.glyphs.find(codepoint);
+    if (found != atlas.glyphs.end())
+    {
+        return &found->second;
+    }
+
+    int minx, maxx, miny, maxy, advance;
+    if (TTF_GlyphMetrics32(font, codepoint, &minx, &maxx, &miny, &maxy, &advance) != 0)
+    {
+        return nullptr;
+    }
+
+    Glyph glyph{};
+    glyph.advance = advance;
+
+    // whitespace has nothing to rasterise, only an advance
+    SDL_Surface *glyphSurface = TTF_RenderGlyph32_Blended(font, codepoint, SDL_Color{255, 255, 255, 255});
+    if (glyphSurface == nullptr || glyphSurface->w == 0 || glyphSurface->h == 0)
+    {
+        SDL_FreeSurface(glyphSurface);
+        glyph.page = -1;
+        return &(atlas.glyphs[codepoint] = glyph);
+    }
+    SDL_Surface *converted = SDL_ConvertSurfaceFormat(glyphSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+    SDL_FreeSurface(glyphSurface);
+    if (converted == nullptr)
+    {
+        std::cerr << "Error: Failed to convert glyph surface: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // shelf packing with 1 pixel padding, move to next shelf when the row is full and a new page when the page is full
+    int w = converted->w + 1;
+    int h = converted->h + 1;
+    if (atlas.pages.empty() || atlas.shelfX + w > pageSize)
+    {
+        atlas.shelfX = 0;
+        atlas.shelfY += atlas.shelfHeight;
+        atlas.shelfHeight = 0;
+    }
+    if (atlas.pages.empty() || atlas.shelfY + h > pageSize)
+    {
+        this->renderer = renderer;
+        SDL_Texture *page = renderer->create_texture(SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, pageSize, pageSize);
+        if (page == nullptr)
+        {
+            std::cerr << "Error: Failed to create glyph atlas page: " << SDL_GetError() << std::endl;
+            SDL_FreeSurface(converted);
+            return nullptr;
+        }
+        // static textures start uninitialised, clear the page so the padding between glyphs can't bleed in when filtered
+        SDL_Surface *blank = SDL_CreateRGBSurfaceWithFormat(0, pageSize, pageSize, 32, SDL_PIXELFORMAT_ARGB8888);
+        if (blank)
+        {
+            renderer->update_texture(page, nullptr, blank->pixels, blank->pitch);
+            SDL_FreeSurface(blank);
+        }
+        renderer->set_texture_blend_mode(page, SDL_BLENDMODE_BLEND);
+        atlas.pages.push_back(page);
+        atlas.shelfX = 0;
+        atlas.shelfY = 0;
+        atlas.shelfHeight = 0;
+    }
+
+    glyph.page = static_cast<int>(atlas.pages.size()) - 1;
+    glyph.src = {atlas.shelfX, atlas.shelfY, converted->w, converted->h};
+    renderer->update_texture(atlas.pages.back(), &glyph.src, converted->pixels, converted->pitch);
+    SDL_FreeSurface(converted);
+
+    atlas.shelfX += w;
+    atlas.shelfHeight = std::max(atlas.shelfHeight, h);
+
+    return &(atlas.glyphs[codepoint] = glyph);
+}
+
+bool GlyphAtlas::draw_text(RenderBackend *renderer, const std::string &text, int x, int y, SDL_Color color, TTF_Font *font)
+{
+    if (font == nullptr)
+    {
+        return false;
+    }
+    std::vector<Uint32> codepoints = decode_utf8(text);
+    for (Uint32 codepoint : codepoints)
+    {
+        if (needs_shaping(codepoint))
+        {
+            return false;
+        }
+    }
+
+    FontAtlas &atlas = atlases[font];
+    for (std::vector<SDL_Vertex> &v : vertices)
+    {
+        v.clear();
+    }
+    for (std::vector<int> &i : indices)
+    {
+        i.clear();
+    }
+
+    bool kerning = TTF_GetFontKerning(font) != 0;
+    int penX = x;
+    Uint32 previous{};
+    for (Uint32 codepoint : codepoints)
+    {
+        const Glyph *glyph = find_or_add_glyph(renderer, font, atlas, codepoint);
+        if (glyph == nullptr)
+        {
+            return false;
+        }
+        if (kerning && previous != 0)
+        {
+            penX += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        }
+        previous = codepoint;
+
+        if (glyph->page >= 0)
+        {
+            if (vertices.size() < atlas.pages.size())
+            {
+                vertices.resize(atlas.pages.size());
+                indices.resize(atlas.pages.size());
+            }
+            std::vector<SDL_Vertex> &v = vertices[glyph->page];
+            std::vector<int> &idx = indices[glyph->page];
+
+            // glyph surfaces are rendered at the full line height so the quad is placed at the pen position
+            float left = static_cast<float>(penX);
+            float top = static_cast<float>(y);
+            float right = left + glyph->src.w;
+            float bottom = top + glyph->src.h;
+            float u0 = static_cast<float>(glyph->src.x) / pageSize;
+            float v0 = static_cast<float>(glyph->src.y) / pageSize;
+            float u1 = static_cast<float>(glyph->src.x + glyph->src.w) / pageSize;
+            float v1 = static_cast<float>(glyph->src.y + glyph->src.h) / pageSize;
+
+            int base = static_cast<int>(v.size());
+            v.push_back(SDL_Vertex{{left, top}, color, {u0, v0}});
+            v.push_back(SDL_Vertex{{right, top}, color, {u1, v0}});
+            v.push_back(SDL_Vertex{{right, bottom}, color, {u1, v1}});
+            v.push_back(SDL_Vertex{{left, bottom}, color, {u0, v1}});
+            idx.insert(idx.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        penX += glyph->advance;
+    }
+
+    // one draw call per atlas page
+    for (size_t page = 0; page < atlas.pages.size() && page < vertices.size(); page++)
+    {
+        if (!vertices[page].empty())
+        {
+            renderer->geometry(atlas.pages[page], vertices[page].data(), static_cast<int>(vertices[page].size()),
+                               indices[page].data(), static_cast<int>(indices[page].size()));
+        }
+    }
+    return true;
+}
+
+void GlyphAtlas::clear()
+{
+    for (auto &pair : atlases)
+    {
+        for (SDL_Texture *page : pair.second.pages)
+        {
+            renderer->destroy_texture(page);
+        }
+    }
+    atlases.clear();
+}
@@ -0,0 +1,292 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::min
+#include <cstdlib>   // for std::abs
+#include "../headers/HeadlessRenderer.hpp"
+
+HeadlessRenderer::HeadlessRenderer()
+{
+    std::cout << "Constructed: HeadlessRenderer" << std::endl;
+}
+
+HeadlessRenderer::~HeadlessRenderer()
+{
+    destroy();
+    std::cout << "Deconstructed: HeadlessRenderer" << std::endl;
+}
+
+bool HeadlessRenderer::create(int width, int height)
+{
+    destroy();
+    this->width = width;
+    this->height = height;
+    created = true;
+    target = nullptr;
+    viewport = {};
+    clipRect = {};
+    drawColor = {};
+    drawBlendMode = SDL_BLENDMODE_NONE;
+    commands.clear();
+    lastFrameCommands.clear();
+    reset_statistics();
+    return true;
+}
+
+void HeadlessRenderer::destroy()
+{
+    if (!created)
+    {
+        return;
+    }
+    for (Texture *texture : textures)
+    {
+        delete texture;
+    }
+    textures.clear();
+    target = nullptr;
+    created = false;
+    next_generation();
+}
+
+HeadlessRenderer::Texture *HeadlessRenderer::find_texture(SDL_Texture *texture, const char *caller) const
+{
+    // the handle is only ever a Texture this backend allocated, check before using it as one
+    Texture *found = reinterpret_cast<Texture *>(texture);
+    if (texture == nullptr || textures.count(found) == 0)
+    {
+        std::cerr << "Error: " << caller << ": not a live headless texture" << std::endl;
+        return nullptr;
+    }
+    return found;
+}
+
+void HeadlessRenderer::record(CommandType type, SDL_Texture *texture, const SDL_Rect *rect)
+{
+    Command command{type, get_category(), texture, target, {}};
+    if (rect)
+    {
+        command.rect = *rect;
+    }
+    commands.push_back(command);
+}
+
+int HeadlessRenderer::draw_clear()
+{
+    record(CommandType::CLEAR, nullptr, nullptr);
+    return 0;
+}
+
+int HeadlessRenderer::draw_fill_rects(const SDL_Rect *rects, int count)
+{
+    record(CommandType::FILL_RECTS, nullptr, count > 0 ? rects : nullptr);
+    return 0;
+}
+
+int HeadlessRenderer::draw_outline_rect(const SDL_Rect *rect)
+{
+    record(CommandType::DRAW_RECT, nullptr, rect);
+    return 0;
+}
+
+int HeadlessRenderer::draw_line_segment(int x1, int y1, int x2, int y2)
+{
+    SDL_Rect bounds = {std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1, std::abs(y2 - y1) + 1};
+    record(CommandType::DRAW_LINE, nullptr, &bounds);
+    return 0;
+}
+
+int HeadlessRenderer::draw_copy(SDL_Texture *texture, const SDL_Rect *, const SDL_Rect *dst)
+{
+    if (find_texture(texture, "copy") == nullptr)
+    {
+        return -1;
+    }
+    record(CommandType::COPY, texture, dst);
+    return 0;
+}
+
+int HeadlessRenderer::draw_geometry(SDL_Texture *texture, const SDL_Vertex *, int, const int *, int)
+{
+    if (texture && find_texture(texture, "geometry") == nullptr)
+    {
+        return -1;
+    }
+    record(CommandType::GEOMETRY, texture, nullptr);
+    return 0;
+}
+
+void HeadlessRenderer::present_frame()
+{
+    // swap so both vectors keep their capacity between frames
+    lastFrameCommands.swap(commands);
+    commands.clear();
+}
+
+int HeadlessRenderer::set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    drawColor = {r, g, b, a};
+    return 0;
+}
+
+int HeadlessRenderer::get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a)
+{
+    *r = drawColor.r;
+    *g = drawColor.g;
+    *b = drawColor.b;
+    *a = drawColor.a;
+    return 0;
+}
+
+int HeadlessRenderer::set_draw_blend_mode(SDL_BlendMode blendMode)
+{
+    drawBlendMode = blendMode;
+    return 0;
+}
+
+int HeadlessRenderer::get_draw_blend_mode(SDL_BlendMode *blendMode)
+{
+    *blendMode = drawBlendMode;
+    return 0;
+}
+
+int HeadlessRenderer::set_target(SDL_Texture *texture)
+{
+    Texture *found = texture ? find_texture(texture, "set_target") : nullptr;
+    if (texture && (found == nullptr || found->access != SDL_TEXTUREACCESS_TARGET))
+    {
+        return -1;
+    }
+    target = texture;
+    viewport = {}; // like SDL a new target starts with the whole target as its viewport
+    clipRect = {};
+    return 0;
+}
+
+SDL_Texture *HeadlessRenderer::get_target()
+{
+    return target;
+}
+
+int HeadlessRenderer::set_viewport(const SDL_Rect *rect)
+{
+    viewport = rect ? *rect : SDL_Rect{};
+    return 0;
+}
+
+void HeadlessRenderer::get_viewport(SDL_Rect *rect)
+{
+    if (viewport.w > 0 && viewport.h > 0)
+    {
+        *rect = viewport;
+        return;
+    }
+    if (target)
+    {
+        Texture *texture = reinterpret_cast<Texture *>(target);
+        *rect = {0, 0, texture->w, texture->h};
+        return;
+    }
+    *rect = {0, 0, width, height};
+}
+
+int HeadlessRenderer::set_clip_rect(const SDL_Rect *rect)
+{
+    clipRect = rect ? *rect : SDL_Rect{};
+    return 0;
+}
+
+int HeadlessRenderer::get_output_size(int *w, int *h)
+{
+    if (w)
+    {
+        *w = width;
+    }
+    if (h)
+    {
+        *h = height;
+    }
+    return 0;
+}
+
+SDL_Texture *HeadlessRenderer::create_texture(Uint32 format, int access, int w, int h)
+{
+    if (w <= 0 || h <= 0)
+    {
+        std::cerr << "Error: Failed to create headless texture: size " << w << "x" << h << std::endl;
+        return nullptr;
+    }
+    Texture *texture = new Texture{format, access, w, h, SDL_BLENDMODE_NONE};
+    textures.insert(texture);
+    return reinterpret_cast<SDL_Texture *>(texture);
+}
+
+SDL_Texture *HeadlessRenderer::create_texture_from_surface(SDL_Surface *surface)
+{
+    if (surface == nullptr)
+    {
+        return nullptr;
+    }
+    SDL_Texture *texture = create_texture(surface->format->format, SDL_TEXTUREACCESS_STATIC, surface->w, surface->h);
+    if (texture)
+    {
+        reinterpret_cast<Texture *>(texture)->blendMode = SDL_BLENDMODE_BLEND; // SDL blends surfaces with alpha
+    }
+    return texture;
+}
+
+int HeadlessRenderer::update_texture(SDL_Texture *texture, const SDL_Rect *, const void *, int)
+{
+    return find_texture(texture, "update_texture") ? 0 : -1;
+}
+
+int HeadlessRenderer::update_yuv_texture(SDL_Texture *texture, const SDL_Rect *, const Uint8 *, int, const Uint8 *, int, const Uint8 *, int)
+{
+    return find_texture(texture, "update_yuv_texture") ? 0 : -1;
+}
+
+int HeadlessRenderer::set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode)
+{
+    Texture *found = find_texture(texture, "set_texture_blend_mode");
+    if (found == nullptr)
+    {
+        return -1;
+    }
+    found->blendMode = blendMode;
+    return 0;
+}
+
+void HeadlessRenderer::destroy_texture(SDL_Texture *texture)
+{
+    if (texture == nullptr)
+    {
+        return;
+    }
+    Texture *found = find_texture(texture, "destroy_texture");
+    if (found == nullptr)
+    {
+        return;
+    }
+    if (texture == target)
+    {
+        target = nullptr;
+    }
+    textures.erase(found);
+    delete found;
+}
+
+const std::vector<HeadlessRenderer::Command> &HeadlessRenderer::get_last_frame_commands() const
+{
+    return lastFrameCommands;
+}
+
+size_t HeadlessRenderer::get_texture_count() const
+{
+    return textures.size();
+}
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include "../headers/EntityManager.hpp"      // Classes for creating entities
 #include "../headers/buttons/BaseButton.hpp" // Classes for creating and drawing GUI elements
+#include "../headers/globals.hpp"            // musicManager
 
 // Modify Maps
 void save_map() {
@@ -99,6 +100,7 @@ void get_music(const std::string directoryPath)
 }
 void play_music(const std::string fileName)
 {
+    musicManager.play(fileName);
 }
 void delete_music(const std::string fileName)
 {
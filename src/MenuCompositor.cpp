@@ -0,0 +1,139 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm>
+#include "../headers/MenuCompositor.hpp"
+
+MenuCompositor::MenuCompositor()
+{
+    std::cout << "Constructed: MenuCompositor" << std::endl;
+}
+
+MenuCompositor::~MenuCompositor()
+{
+    std::cout << "Deconstructed: MenuCompositor" << std::endl;
+}
+
+void MenuCompositor::draw_scene(RenderBackend *renderer, int scene, size_t signature, const std::function<void()> &drawScene)
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::MENUS);
+    int width{}, height{};
+    renderer->get_output_size(&width, &height);
+
+    CachedScene &cached = scenes[scene];
+    if (cached.texture == nullptr || cached.width != width || cached.height != height)
+    {
+        if (cached.texture)
+        {
+            renderer->destroy_texture(cached.texture);
+        }
+        this->renderer = renderer;
+        cached.texture = renderer->create_texture(SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        cached.width = width;
+        cached.height = height;
+        if (cached.texture == nullptr)
+        {
+            // render targets not supported, draw every frame like before
+            drawScene();
+            return;
+        }
+        renderer->set_texture_blend_mode(cached.texture, SDL_BLENDMODE_NONE); // opaque full screen copy
+        cached.signature = signature + 1; // force compose
+    }
+
+    if (cached.signature != signature)
+    {
+        compose(cached, drawScene, nullptr);
+        cached.signature = signature;
+    }
+    else
+    {
+        // a button that changed covers its old and new rect, e.g. the highlight moving clears the old border
+        std::vector<SDL_Rect> dirtyRects{};
+        for (const DrawnButton &drawn : cached.buttons)
+        {
+            if (drawn.button->get_draw_signature() != drawn.signature)
+            {
+                SDL_Rect rect = drawn.button->get_rect();
+                SDL_Rect area = {rect.x - 2, rect.y - 2, rect.w + 4, rect.h + 4};
+                SDL_UnionRect(&drawn.area, &area, &area);
+                dirtyRects.push_back(area);
+            }
+        }
+        for (const SDL_Rect &rect : dirtyRects)
+        {
+            compose(cached, drawScene, &rect);
+        }
+    }
+
+    renderer->copy(cached.texture, nullptr, nullptr);
+}
+
+void MenuCompositor::compose(CachedScene &cached, const std::function<void()> &drawScene, const SDL_Rect *clip)
+{
+    SDL_Texture *previousTarget = renderer->get_target();
+    renderer->set_target(cached.texture);
+    renderer->set_draw_color(0, 0, 0, 255);
+    if (clip)
+    {
+        renderer->set_clip_rect(clip);
+        renderer->fill_rect(clip); // clear() ignores the clip rect
+    }
+    else
+    {
+        renderer->clear();
+    }
+
+    // the whole scene is drawn so buttons overlapping the clip keep their order, the clip limits the pixels changed
+    BaseButton::drawnButtons.clear();
+    BaseButton::recordingDrawnButtons = true;
+    drawScene();
+    BaseButton::recordingDrawnButtons = false;
+
+    // dropdown lists draw the same button at several rects, so one entry covers all of them
+    cached.buttons.clear();
+    for (const std::pair<BaseButton *, SDL_Rect> &pair : BaseButton::drawnButtons)
+    {
+        SDL_Rect area = {pair.second.x - 2, pair.second.y - 2, pair.second.w + 4, pair.second.h + 4};
+        auto it = std::find_if(cached.buttons.begin(), cached.buttons.end(), [&](const DrawnButton &drawn)
+                               { return drawn.button == pair.first; });
+        if (it == cached.buttons.end())
+        {
+            cached.buttons.push_back({pair.first, area, 0});
+        }
+        else
+        {
+            SDL_UnionRect(&it->area, &area, &it->area);
+        }
+    }
+    // taken after drawScene() returns as drawing can change a button e.g. a dropdown takes its selected label
+    for (DrawnButton &drawn : cached.buttons)
+    {
+        drawn.signature = drawn.button->get_draw_signature();
+    }
+    BaseButton::drawnButtons.clear();
+
+    if (clip)
+    {
+        renderer->set_clip_rect(nullptr);
+    }
+    renderer->set_target(previousTarget);
+}
+
+void MenuCompositor::clear()
+{
+    for (auto &pair : scenes)
+    {
+        if (pair.second.texture)
+        {
+            renderer->destroy_texture(pair.second.texture);
+        }
+    }
+    scenes.clear();
+}
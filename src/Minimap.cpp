@@ -0,0 +1,114 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::sort
+#include "../headers/Minimap.hpp"
+
+static Uint32 color_key(const SDL_Color &color)
+{
+    return (static_cast<Uint32>(color.r) << 24) | (static_cast<Uint32>(color.g) << 16) | (static_cast<Uint32>(color.b) << 8) | color.a;
+}
+
+Minimap::Minimap(Uint32 refreshInterval) : refreshInterval(refreshInterval)
+{
+    std::cout << "Constructed: Minimap" << std::endl;
+}
+
+Minimap::~Minimap()
+{
+    std::cout << "Deconstructed: Minimap" << std::endl;
+}
+
+void Minimap::draw(RenderBackend *renderer, const SDL_Rect &area, unsigned int revision, const std::function<void()> &drawTerrain,
+                   const std::function<void(std::vector<Marker> &)> &collectMarkers)
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::HUD);
+    if (area.w <= 0 || area.h <= 0)
+    {
+        return;
+    }
+
+    if (terrainTexture == nullptr || terrainWidth != area.w || terrainHeight != area.h)
+    {
+        if (terrainTexture)
+        {
+            renderer->destroy_texture(terrainTexture);
+        }
+        this->renderer = renderer;
+        terrainTexture = renderer->create_texture(SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, area.w, area.h);
+        terrainWidth = area.w;
+        terrainHeight = area.h;
+        terrainDrawn = false;
+    }
+
+    if (terrainTexture)
+    {
+        if (!terrainDrawn || terrainRevision != revision)
+        {
+            SDL_Texture *previousTarget = renderer->get_target();
+            renderer->set_target(terrainTexture);
+            renderer->set_draw_color(0, 0, 0, 255);
+            renderer->clear();
+            drawTerrain();
+            renderer->set_target(previousTarget);
+            terrainRevision = revision;
+            terrainDrawn = true;
+        }
+        renderer->copy(terrainTexture, nullptr, &area);
+    }
+    else
+    {
+        // render targets not supported, draw the terrain straight into the minimap area every frame
+        SDL_Rect previousViewport{};
+        renderer->get_viewport(&previousViewport);
+        renderer->set_viewport(&area);
+        drawTerrain();
+        renderer->set_viewport(&previousViewport);
+    }
+
+    Uint32 now = SDL_GetTicks();
+    if (lastRefresh == 0 || now - lastRefresh >= refreshInterval)
+    {
+        markers.clear();
+        collectMarkers(markers);
+        std::sort(markers.begin(), markers.end(), [](const Marker &a, const Marker &b)
+                  { return color_key(a.color) < color_key(b.color); });
+        lastRefresh = now;
+    }
+
+    // one fill call per marker color
+    size_t i = 0;
+    while (i < markers.size())
+    {
+        const SDL_Color &color = markers[i].color;
+        markerRects.clear();
+        while (i < markers.size() && color_key(markers[i].color) == color_key(color))
+        {
+            SDL_Rect rect = markers[i].rect;
+            rect.x += area.x;
+            rect.y += area.y;
+            markerRects.push_back(rect);
+            i++;
+        }
+        renderer->set_draw_color(color.r, color.g, color.b, color.a);
+        renderer->fill_rects(markerRects.data(), static_cast<int>(markerRects.size()));
+    }
+}
+
+void Minimap::clear()
+{
+    if (terrainTexture)
+    {
+        renderer->destroy_texture(terrainTexture);
+        terrainTexture = nullptr;
+    }
+    terrainDrawn = false;
+    markers.clear();
+    lastRefresh = 0;
+}
@@ -0,0 +1,269 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include "../headers/MusicManager.hpp"
+#include "../headers/globals.hpp" // logger
+
+MusicManager::MusicManager(int fadeDuration) : fadeDuration(fadeDuration)
+{
+    std::cout << "Constructed: MusicManager" << std::endl;
+}
+
+MusicManager::~MusicManager()
+{
+    stop();
+    std::cout << "Deconstructed: MusicManager" << std::endl;
+}
+
+void MusicManager::start()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (worker.joinable())
+    {
+        return;
+    }
+    stopping = false;
+    worker = std::thread(&MusicManager::worker_loop, this);
+}
+
+void MusicManager::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    requestReady.notify_all();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const std::string &path : requests)
+    {
+        loading.erase(path);
+    }
+    requests.clear();
+}
+
+void MusicManager::worker_loop()
+{
+    while (true)
+    {
+        std::string path{};
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            requestReady.wait(lock, [this]()
+                              { return stopping || !requests.empty(); });
+            if (stopping)
+            {
+                return;
+            }
+            path = requests.front();
+            requests.pop_front();
+        }
+
+        // file open and MP3 header scan happen here, off the main thread, a failure is logged by collect_loaded()
+        Loaded track{path};
+        {
+            std::lock_guard<std::mutex> loadLock(loadMutex);
+            track.music = Mix_LoadMUS(path.c_str());
+            if (track.music == nullptr)
+            {
+                track.error = Mix_GetError();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        loaded.push_back(track);
+    }
+}
+
+std::unique_lock<std::mutex> MusicManager::pause_loading()
+{
+    return std::unique_lock<std::mutex>(loadMutex);
+}
+
+void MusicManager::request(const std::string &filePath)
+{
+    if (tracks.count(filePath) || loading.count(filePath))
+    {
+        return;
+    }
+    loading.insert(filePath);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!worker.joinable())
+    {
+        // no worker thread, load here and pick it up with the next update() like a threaded load
+        lock.unlock();
+        Loaded track{filePath, Mix_LoadMUS(filePath.c_str())};
+        if (track.music == nullptr)
+        {
+            track.error = Mix_GetError();
+        }
+        lock.lock();
+        loaded.push_back(track);
+    }
+    else
+    {
+        requests.push_back(filePath);
+        lock.unlock();
+        requestReady.notify_one();
+    }
+}
+
+void MusicManager::free_if_unused(const std::string &filePath)
+{
+    if (filePath.empty() || filePath == current || filePath == next || preloaded.count(filePath))
+    {
+        return;
+    }
+    auto found = tracks.find(filePath);
+    if (found != tracks.end())
+    {
+        Mix_FreeMusic(found->second);
+        tracks.erase(found);
+    }
+}
+
+void MusicManager::preload(const std::string &filePath)
+{
+    if (filePath != current)
+    {
+        preloaded.insert(filePath);
+    }
+    request(filePath);
+}
+
+void MusicManager::play(const std::string &filePath)
+{
+    std::string superseded = next;
+    if (filePath == current && !fadingOut)
+    {
+        next.clear();
+        free_if_unused(superseded);
+        return; // already playing, keep going instead of reloading
+    }
+    next = filePath;
+    free_if_unused(superseded); // e.g. play() called again before the previous track finished loading
+    request(filePath);
+}
+
+void MusicManager::collect_loaded()
+{
+    std::deque<Loaded> ready{};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(loaded);
+    }
+    for (Loaded &track : ready)
+    {
+        loading.erase(track.path);
+        if (track.music == nullptr)
+        {
+            logger.log_critical("Error: Failed to load music: " + track.path + ": " + track.error);
+            preloaded.erase(track.path);
+            if (track.path == next)
+            {
+                next.clear(); // keep playing the current track
+            }
+            continue;
+        }
+        tracks[track.path] = track.music;
+        free_if_unused(track.path); // superseded while it was loading
+    }
+}
+
+void MusicManager::update()
+{
+    collect_loaded();
+    if (next.empty() || tracks.count(next) == 0)
+    {
+        return;
+    }
+
+    bool paused = Mix_PausedMusic() != 0;
+    if (!current.empty() && Mix_PlayingMusic() && !paused)
+    {
+        if (!fadingOut)
+        {
+            Mix_FadeOutMusic(fadeDuration);
+            fadingOut = true;
+        }
+        return; // wait for the fade out to finish
+    }
+    if (paused)
+    {
+        Mix_HaltMusic(); // a paused track never fades, swap straight away and stay paused
+    }
+
+    std::string previous = current;
+    current = next;
+    next.clear();
+    preloaded.erase(current); // freed like any other track once replaced
+    fadingOut = false;
+    if (Mix_FadeInMusic(tracks[current], -1, fadeDuration) == -1) // -1 loops forever
+    {
+        logger.log_critical("Error: Failed to play music: " + current + ": " + Mix_GetError());
+    }
+    else
+    {
+        logger.log_non_critical("Music playing is: " + current);
+        if (paused)
+        {
+            Mix_PauseMusic();
+        }
+    }
+
+    // the replaced track has finished fading out, free it
+    free_if_unused(previous);
+}
+
+void MusicManager::restart(bool paused)
+{
+    auto found = tracks.find(current);
+    if (fadingOut || found == tracks.end())
+    {
+        return; // a track fading out for the next one doesn't need restarting, update() starts the next track
+    }
+    if (Mix_FadeInMusic(found->second, -1, fadeDuration) == -1)
+    {
+        logger.log_critical("Error: Failed to play music: " + current + ": " + Mix_GetError());
+    }
+    else if (paused)
+    {
+        Mix_PauseMusic();
+    }
+}
+
+void MusicManager::clear()
+{
+    Mix_HaltMusic();
+    collect_loaded();
+    for (auto &track : tracks)
+    {
+        Mix_FreeMusic(track.second);
+    }
+    tracks.clear();
+    preloaded.clear();
+    current.clear();
+    next.clear();
+    fadingOut = false;
+}
+
+const std::string &MusicManager::get_current() const
+{
+    return current;
+}
+
+size_t MusicManager::get_track_count() const
+{
+    return tracks.size();
+}
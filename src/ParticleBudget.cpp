@@ -0,0 +1,94 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::min, std::max
+#include "../headers/ParticleBudget.hpp"
+
+ParticleBudget::ParticleBudget(size_t globalCap, float frameBudget) : globalCap(globalCap), frameBudget(frameBudget)
+{
+    std::cout << "Constructed: ParticleBudget" << std::endl;
+}
+
+ParticleBudget::~ParticleBudget()
+{
+    std::cout << "Deconstructed: ParticleBudget" << std::endl;
+}
+
+int ParticleBudget::request(ParticlePriority priority, int amount, size_t liveCount)
+{
+    if (amount <= 0)
+    {
+        return 0;
+    }
+    int p = static_cast<int>(priority);
+
+    // lower priorities leave headroom in the cap for more important effects
+    size_t cap = globalCap;
+    float scale = 1.0f;
+    if (priority == ParticlePriority::LOW)
+    {
+        cap = globalCap / 2;
+        scale = spawnScale * spawnScale;
+    }
+    else if (priority == ParticlePriority::NORMAL)
+    {
+        cap = globalCap - globalCap / 5;
+        scale = spawnScale;
+    }
+
+    carry[p] += static_cast<float>(amount) * scale;
+    int allowed = static_cast<int>(carry[p]);
+    carry[p] -= static_cast<float>(allowed);
+    allowed = std::min(allowed, amount);
+
+    size_t room = liveCount < cap ? cap - liveCount : 0;
+    allowed = static_cast<int>(std::min(static_cast<size_t>(allowed), room));
+
+    dropped[p] += static_cast<unsigned long long>(amount - allowed);
+    return allowed;
+}
+
+void ParticleBudget::set_frame_budget(float frameBudget)
+{
+    this->frameBudget = frameBudget;
+}
+
+void ParticleBudget::end_frame(float frameTime)
+{
+    // smoothed so a single slow frame e.g. a level loading doesn't thin effects on its own
+    averageFrameTime = averageFrameTime * 0.8f + frameTime * 0.2f;
+    if (averageFrameTime > frameBudget)
+    {
+        spawnScale = std::max(MIN_SPAWN_SCALE, spawnScale * 0.8f);
+    }
+    else
+    {
+        spawnScale = std::min(1.0f, spawnScale + 0.02f);
+    }
+}
+
+float ParticleBudget::get_spawn_scale() const
+{
+    return spawnScale;
+}
+
+unsigned long long ParticleBudget::get_dropped_count(ParticlePriority priority) const
+{
+    return dropped[static_cast<int>(priority)];
+}
+
+unsigned long long ParticleBudget::get_dropped_count() const
+{
+    unsigned long long total{};
+    for (unsigned long long count : dropped)
+    {
+        total += count;
+    }
+    return total;
+}
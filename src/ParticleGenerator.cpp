@@ -6,105 +6,310 @@
     License: MIT License
 */
 
+#include <random> // for seeding with std::random_device
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 #include "../headers/ParticleGenerator.hpp"
 
-ParticleGenerator::ParticleGenerator(int xPos, int yPos, std::string animation) : xPos(xPos), yPos(yPos), animation(animation)
+ParticleGenerator::ParticleGenerator(size_t capacity, OverflowPolicy overflowPolicy, ParticleBudget *budget) : capacity(capacity), overflowPolicy(overflowPolicy), budget(budget)
 {
-    // Creation logic for item entities
+    xPos.resize(capacity);
+    yPos.resize(capacity);
+    xVelocity.resize(capacity);
+    yVelocity.resize(capacity);
+    gravity.resize(capacity);
+    life.resize(capacity);
+    colors.resize(capacity);
+
+    // one seed per pool, xorshift state must not be 0
     std::random_device rd;
-    std::mt19937 gen(rd());
+    randomState = rd();
+    if (randomState == 0)
+    {
+        randomState = 0x9E3779B9u;
+    }
+}
 
-    // Random velocity
-    std::uniform_int_distribution<int> xDistribution(-2, 2);  // For x velocity -2, -1, 0, 1, 2
-    std::uniform_int_distribution<int> yDistribution(-9, -5); // For y velocity -9, -8, -7, -6, -5
+size_t ParticleGenerator::acquire_slot()
+{
+    if (count < capacity)
+    {
+        return count++;
+    }
+    overflowCount++;
+    if (overflowPolicy == OverflowPolicy::DROP_NEW || capacity == 0)
+    {
+        return capacity;
+    }
+    size_t index = overwriteIndex;
+    overwriteIndex = (overwriteIndex + 1) % capacity;
+    return index;
+}
 
-    vx = xDistribution(gen);
-    vy = yDistribution(gen);
+std::uint32_t ParticleGenerator::next_random()
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+int ParticleGenerator::random_range(int min, int max)
+{
+    // scale the 32 bit number into the range with a multiply instead of a modulo
+    std::uint64_t range = static_cast<std::uint64_t>(max - min + 1);
+    return min + static_cast<int>((static_cast<std::uint64_t>(next_random()) * range) >> 32);
+}
 
-    if (animation == "fireworks")
+void ParticleGenerator::emit(ParticlePreset preset, int x, int y, int amount)
+{
+    const EmitterPreset &emitter = PARTICLE_PRESETS[static_cast<int>(preset)];
+    if (budget)
     {
-        // draw fireworks
-        std::uniform_int_distribution<int> colorDistribution(0, 255);
-        r = colorDistribution(gen);
-        g = colorDistribution(gen);
-        b = colorDistribution(gen);
-        a = colorDistribution(gen);
+        amount = budget->request(emitter.priority, amount, count);
     }
-
-    if (animation == "water")
+    for (int n = 0; n < amount; n++)
     {
-        // draw different water particle colours
-        std::uniform_int_distribution<int> colorDistribution(0, 255);
-        int random = colorDistribution(gen) % 2;
-        if (random == 0)
-        {
-            // add blue water particles
-            b = colorDistribution(gen);
-            a = colorDistribution(gen);
-        }
-        else
+        size_t i = acquire_slot();
+        if (i == capacity)
         {
-            // add some white colours to water
-            b = 255;
-            r = 255;
-            g = 255;
-            a = colorDistribution(gen);
+            overflowCount += amount - n - 1; // the rest of the burst doesn't fit either
+            return;
         }
+
+        xPos[i] = static_cast<float>(x);
+        yPos[i] = static_cast<float>(y);
+        xVelocity[i] = static_cast<float>(random_range(emitter.minXVelocity, emitter.maxXVelocity));
+        yVelocity[i] = static_cast<float>(random_range(emitter.minYVelocity, emitter.maxYVelocity));
+        gravity[i] = emitter.gravity;
+        life[i] = emitter.lifetime;
+
+        const ParticleColorRange &range = emitter.palette[emitter.paletteSize > 1 ? random_range(0, emitter.paletteSize - 1) : 0];
+        colors[i] = {static_cast<Uint8>(random_range(range.min.r, range.max.r)),
+                     static_cast<Uint8>(random_range(range.min.g, range.max.g)),
+                     static_cast<Uint8>(random_range(range.min.b, range.max.b)),
+                     static_cast<Uint8>(random_range(range.min.a, range.max.a))};
     }
+}
+
+void ParticleGenerator::move(size_t from, size_t to)
+{
+    xPos[to] = xPos[from];
+    yPos[to] = yPos[from];
+    xVelocity[to] = xVelocity[from];
+    yVelocity[to] = yVelocity[from];
+    gravity[to] = gravity[from];
+    life[to] = life[from];
+    colors[to] = colors[from];
+}
 
-    if (animation == "fire")
+size_t ParticleGenerator::compact(size_t first, size_t width, unsigned int deadMask, size_t alive)
+{
+    if (deadMask == 0 && alive == first)
     {
-        // draw different fire particle colours
-        std::uniform_int_distribution<int> colorDistribution(0, 255);
-        int random = colorDistribution(gen) % 2;
-        if (random == 0)
+        return alive + width; // nothing died and nothing has been removed before, already in place
+    }
+    for (size_t lane = 0; lane < width; lane++)
+    {
+        if ((deadMask >> lane) & 1u)
         {
-            // add red flame particles
-            r = colorDistribution(gen);
-            a = colorDistribution(gen);
+            continue;
         }
-        else
+        if (alive != first + lane)
         {
-            // add some yellow colours to flame
-            r = 255;
-            g = 255;
-            a = 128 + colorDistribution(gen) % 128;
+            move(first + lane, alive);
         }
+        alive++;
     }
+    return alive;
 }
 
-void ParticleGenerator::update()
+void ParticleGenerator::update(const SDL_Rect &cullRect)
 {
-    // Update position based on velocity
-    xPos += vx;
-    yPos += vy;
+    const float left = static_cast<float>(cullRect.x);
+    const float right = static_cast<float>(cullRect.x + cullRect.w);
+    const float bottom = static_cast<float>(cullRect.y + cullRect.h);
+    size_t alive = 0; // live particles are compacted to the front as the sweep goes, alive <= i so nothing unread is overwritten
+    size_t i = 0;
 
-    // Apply gravity
-    vy += 1;
+#if defined(__AVX2__)
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 leftEdge = _mm256_set1_ps(left);
+    const __m256 rightEdge = _mm256_set1_ps(right);
+    const __m256 bottomEdge = _mm256_set1_ps(bottom);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(&xPos[i]), _mm256_loadu_ps(&xVelocity[i]));
+        __m256 vy = _mm256_loadu_ps(&yVelocity[i]);
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(&yPos[i]), vy);
+        vy = _mm256_add_ps(vy, _mm256_loadu_ps(&gravity[i]));
+        __m256 l = _mm256_sub_ps(_mm256_loadu_ps(&life[i]), one);
+        _mm256_storeu_ps(&xPos[i], x);
+        _mm256_storeu_ps(&yPos[i], y);
+        _mm256_storeu_ps(&yVelocity[i], vy);
+        _mm256_storeu_ps(&life[i], l);
+
+        __m256 dead = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(l, zero, _CMP_LE_OQ), _mm256_cmp_ps(y, bottomEdge, _CMP_GT_OQ)),
+                                   _mm256_or_ps(_mm256_cmp_ps(x, leftEdge, _CMP_LT_OQ), _mm256_cmp_ps(x, rightEdge, _CMP_GE_OQ)));
+        alive = compact(i, 8, static_cast<unsigned int>(_mm256_movemask_ps(dead)), alive);
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 leftEdge = _mm_set1_ps(left);
+    const __m128 rightEdge = _mm_set1_ps(right);
+    const __m128 bottomEdge = _mm_set1_ps(bottom);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_add_ps(_mm_loadu_ps(&xPos[i]), _mm_loadu_ps(&xVelocity[i]));
+        __m128 vy = _mm_loadu_ps(&yVelocity[i]);
+        __m128 y = _mm_add_ps(_mm_loadu_ps(&yPos[i]), vy);
+        vy = _mm_add_ps(vy, _mm_loadu_ps(&gravity[i]));
+        __m128 l = _mm_sub_ps(_mm_loadu_ps(&life[i]), one);
+        _mm_storeu_ps(&xPos[i], x);
+        _mm_storeu_ps(&yPos[i], y);
+        _mm_storeu_ps(&yVelocity[i], vy);
+        _mm_storeu_ps(&life[i], l);
+
+        __m128 dead = _mm_or_ps(_mm_or_ps(_mm_cmple_ps(l, zero), _mm_cmpgt_ps(y, bottomEdge)),
+                                _mm_or_ps(_mm_cmplt_ps(x, leftEdge), _mm_cmpge_ps(x, rightEdge)));
+        alive = compact(i, 4, static_cast<unsigned int>(_mm_movemask_ps(dead)), alive);
+    }
+#endif
+
+    // scalar fallback, and the particles left over after the last full SIMD block
+    finish_update(update_scalar_range(i, alive, left, right, bottom));
+}
+
+void ParticleGenerator::update_scalar(const SDL_Rect &cullRect)
+{
+    finish_update(update_scalar_range(0, 0, static_cast<float>(cullRect.x), static_cast<float>(cullRect.x + cullRect.w), static_cast<float>(cullRect.y + cullRect.h)));
 }
 
-void ParticleGenerator::render_particles(std::vector<ParticleGenerator> &particles, SDL_Renderer *renderer)
+size_t ParticleGenerator::update_scalar_range(size_t first, size_t alive, float left, float right, float bottom)
 {
-    for (auto &particle : particles)
+    for (size_t i = first; i < count; i++)
     {
-        particle.update();
-        SDL_SetRenderDrawColor(renderer, particle.r, particle.g, particle.b, particle.a);
-        SDL_Rect rect = {particle.xPos, particle.yPos, 3, 3}; // Increase size here
-        SDL_RenderFillRect(renderer, &rect);
+        // Update position based on velocity
+        xPos[i] += xVelocity[i];
+        yPos[i] += yVelocity[i];
+
+        // Apply gravity
+        yVelocity[i] += gravity[i];
+        life[i] -= 1.0f;
+
+        bool dead = life[i] <= 0.0f || yPos[i] > bottom || xPos[i] < left || xPos[i] >= right;
+        alive = compact(i, 1, dead ? 1u : 0u, alive);
+    }
+    return alive;
+}
+
+void ParticleGenerator::finish_update(size_t alive)
+{
+    count = alive;
+    if (overwriteIndex >= count)
+    {
+        overwriteIndex = 0;
     }
 }
 
-void ParticleGenerator::clear_particles(std::vector<ParticleGenerator> &particles, int SCREEN_HEIGHT)
+void ParticleGenerator::render(RenderBackend *renderer, const SDL_Rect &camera)
 {
-    for (auto it = particles.begin(); it != particles.end();)
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::PARTICLES);
+    if (count == 0)
+    {
+        return;
+    }
+
+    // two triangles per particle, the index pattern only depends on the particle count so it's only extended
+    size_t oldQuads = indices.size() / 6;
+    if (oldQuads < count)
     {
-        if (it->yPos > SCREEN_HEIGHT)
+        indices.resize(count * 6);
+        for (size_t quad = oldQuads; quad < count; quad++)
         {
-            it = particles.erase(it);
+            int first = static_cast<int>(quad * 4);
+            int *index = &indices[quad * 6];
+            index[0] = first;
+            index[1] = first + 1;
+            index[2] = first + 2;
+            index[3] = first + 2;
+            index[4] = first + 3;
+            index[5] = first;
         }
-        else
+    }
+
+    vertices.resize(count * 4);
+    const float cameraX = static_cast<float>(camera.x);
+    const float cameraY = static_cast<float>(camera.y);
+    for (size_t i = 0; i < count; i++)
+    {
+        // particles are in game world coordinates, displaced by the camera like entities
+        float left = xPos[i] - cameraX;
+        float top = yPos[i] - cameraY;
+        SDL_Vertex *quad = &vertices[i * 4];
+        quad[0] = {{left, top}, colors[i], {0.0f, 0.0f}};
+        quad[1] = {{left + PARTICLE_SIZE, top}, colors[i], {0.0f, 0.0f}};
+        quad[2] = {{left + PARTICLE_SIZE, top + PARTICLE_SIZE}, colors[i], {0.0f, 0.0f}};
+        quad[3] = {{left, top + PARTICLE_SIZE}, colors[i], {0.0f, 0.0f}};
+    }
+
+    // untextured geometry uses the renderer blend mode, one call for every particle
+    SDL_BlendMode previousBlend;
+    renderer->get_draw_blend_mode(&previousBlend);
+    renderer->set_draw_blend_mode(SDL_BLENDMODE_BLEND);
+    if (renderer->geometry(nullptr, vertices.data(), static_cast<int>(count * 4), indices.data(), static_cast<int>(count * 6)) != 0)
+    {
+        // renderer without geometry support, draw each particle
+        Uint8 r, g, b, a;
+        renderer->get_draw_color(&r, &g, &b, &a);
+        for (size_t i = 0; i < count; i++)
         {
-            ++it;
+            renderer->set_draw_color(colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+            SDL_Rect rect = {static_cast<int>(xPos[i]) - camera.x, static_cast<int>(yPos[i]) - camera.y, static_cast<int>(PARTICLE_SIZE), static_cast<int>(PARTICLE_SIZE)};
+            renderer->fill_rect(&rect);
         }
+        renderer->set_draw_color(r, g, b, a);
     }
+    renderer->set_draw_blend_mode(previousBlend);
+}
+
+void ParticleGenerator::clear()
+{
+    count = 0;
+    overwriteIndex = 0;
+}
+
+float ParticleGenerator::get_x(size_t index) const
+{
+    return xPos[index];
+}
+
+float ParticleGenerator::get_y(size_t index) const
+{
+    return yPos[index];
+}
+
+float ParticleGenerator::get_life(size_t index) const
+{
+    return life[index];
+}
+
+size_t ParticleGenerator::get_count() const
+{
+    return count;
+}
+
+size_t ParticleGenerator::get_capacity() const
+{
+    return capacity;
+}
+
+unsigned long long ParticleGenerator::get_overflow_count() const
+{
+    return overflowCount;
 }
@@ -0,0 +1,138 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <SDL2/SDL_image.h>
+#include "../headers/RenderBackend.hpp"
+
+void RenderBackend::count_draw_call()
+{
+    drawCalls[static_cast<int>(category)]++;
+}
+
+void RenderBackend::reset_statistics()
+{
+    for (int i = 0; i < CATEGORY_COUNT; i++)
+    {
+        drawCalls[i] = 0;
+        lastFrameDrawCalls[i] = 0;
+        totalDrawCalls[i] = 0;
+    }
+    frames = 0;
+}
+
+void RenderBackend::next_generation()
+{
+    generation++;
+}
+
+RenderBackend::DrawCategory RenderBackend::set_category(DrawCategory category)
+{
+    DrawCategory previous = this->category;
+    this->category = category;
+    return previous;
+}
+
+RenderBackend::DrawCategory RenderBackend::get_category() const
+{
+    return category;
+}
+
+int RenderBackend::clear()
+{
+    count_draw_call();
+    return draw_clear();
+}
+
+int RenderBackend::fill_rect(const SDL_Rect *rect)
+{
+    count_draw_call();
+    if (rect == nullptr)
+    {
+        SDL_Rect viewport{};
+        get_viewport(&viewport);
+        SDL_Rect whole = {0, 0, viewport.w, viewport.h};
+        return draw_fill_rects(&whole, 1);
+    }
+    return draw_fill_rects(rect, 1);
+}
+
+int RenderBackend::fill_rects(const SDL_Rect *rects, int count)
+{
+    count_draw_call();
+    return draw_fill_rects(rects, count);
+}
+
+int RenderBackend::draw_rect(const SDL_Rect *rect)
+{
+    count_draw_call();
+    return draw_outline_rect(rect);
+}
+
+int RenderBackend::draw_line(int x1, int y1, int x2, int y2)
+{
+    count_draw_call();
+    return draw_line_segment(x1, y1, x2, y2);
+}
+
+int RenderBackend::copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst)
+{
+    count_draw_call();
+    return draw_copy(texture, src, dst);
+}
+
+int RenderBackend::geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount)
+{
+    count_draw_call();
+    return draw_geometry(texture, vertices, vertexCount, indices, indexCount);
+}
+
+void RenderBackend::present()
+{
+    present_frame();
+    for (int i = 0; i < CATEGORY_COUNT; i++)
+    {
+        lastFrameDrawCalls[i] = drawCalls[i];
+        totalDrawCalls[i] += drawCalls[i];
+        drawCalls[i] = 0;
+    }
+    frames++;
+}
+
+SDL_Texture *RenderBackend::load_texture(const std::string &filePath)
+{
+    SDL_Surface *surface = IMG_Load(filePath.c_str());
+    if (surface == nullptr)
+    {
+        std::cerr << "Error: Failed to load image: " << filePath << ": " << IMG_GetError() << std::endl;
+        return nullptr;
+    }
+    SDL_Texture *texture = create_texture_from_surface(surface);
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+unsigned long long RenderBackend::get_draw_calls(DrawCategory category) const
+{
+    return lastFrameDrawCalls[static_cast<int>(category)];
+}
+
+unsigned long long RenderBackend::get_total_draw_calls(DrawCategory category) const
+{
+    return totalDrawCalls[static_cast<int>(category)];
+}
+
+unsigned long long RenderBackend::get_frame_count() const
+{
+    return frames;
+}
+
+unsigned int RenderBackend::get_generation() const
+{
+    return generation;
+}
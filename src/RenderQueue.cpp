@@ -0,0 +1,134 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::clamp
+#include "../headers/RenderQueue.hpp"
+
+RenderQueue::RenderQueue()
+{
+    std::cout << "Constructed: RenderQueue" << std::endl;
+}
+
+RenderQueue::~RenderQueue()
+{
+    std::cout << "Deconstructed: RenderQueue" << std::endl;
+}
+
+std::uint64_t RenderQueue::make_key(Uint8 layer, int zPos, std::uint32_t textureId, SDL_BlendMode blend)
+{
+    // bias zPos so negative depths sort below positive ones
+    std::uint64_t depth = static_cast<std::uint64_t>(std::clamp(zPos, -32768, 32767) + 32768);
+    return (static_cast<std::uint64_t>(layer) << 56) |
+           (depth << 40) |
+           (static_cast<std::uint64_t>(textureId & 0xFFFFFF) << 16) |
+           (static_cast<std::uint64_t>(blend & 0xFF) << 8);
+}
+
+std::uint32_t RenderQueue::get_texture_id(SDL_Texture *texture)
+{
+    auto found = textureIds.find(texture);
+    if (found != textureIds.end())
+    {
+        return found->second;
+    }
+    std::uint32_t id = static_cast<std::uint32_t>(textureIds.size());
+    textureIds[texture] = id;
+    return id;
+}
+
+void RenderQueue::copy(Uint8 layer, int zPos, SDL_Texture *texture, const SDL_Rect &rect, SDL_BlendMode blend)
+{
+    if (!texture)
+    {
+        return;
+    }
+    entries.push_back(SortEntry{make_key(layer, zPos, get_texture_id(texture), blend), static_cast<std::uint32_t>(commands.size())});
+    commands.push_back(Command{texture, rect, blend});
+}
+
+void RenderQueue::radix_sort()
+{
+    if (entries.size() < 2)
+    {
+        return;
+    }
+    // bits set in some keys but not others, bytes where every key matches need no pass
+    std::uint64_t differing{};
+    for (const SortEntry &entry : entries)
+    {
+        differing |= entry.key ^ entries[0].key;
+    }
+
+    scratch.resize(entries.size());
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        if (((differing >> shift) & 0xFF) == 0)
+        {
+            continue;
+        }
+        size_t counts[257]{};
+        for (const SortEntry &entry : entries)
+        {
+            counts[((entry.key >> shift) & 0xFF) + 1]++;
+        }
+        for (int i = 0; i < 256; i++)
+        {
+            counts[i + 1] += counts[i];
+        }
+        for (const SortEntry &entry : entries)
+        {
+            scratch[counts[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void RenderQueue::submit(RenderBackend *renderer)
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::SPRITES);
+    radix_sort();
+
+    lastCommandCount = static_cast<int>(entries.size());
+    lastStateChanges = 0;
+    SDL_Texture *currentTexture{};
+    SDL_BlendMode currentBlend{};
+
+    for (const SortEntry &entry : entries)
+    {
+        const Command &command = commands[entry.command];
+        if (command.texture != currentTexture || command.blend != currentBlend)
+        {
+            renderer->set_texture_blend_mode(command.texture, command.blend);
+            currentTexture = command.texture;
+            currentBlend = command.blend;
+            lastStateChanges++;
+        }
+        renderer->copy(command.texture, nullptr, &command.rect);
+    }
+
+    commands.clear();
+    entries.clear();
+}
+
+void RenderQueue::clear()
+{
+    commands.clear();
+    entries.clear();
+    textureIds.clear();
+}
+
+int RenderQueue::get_last_command_count() const
+{
+    return lastCommandCount;
+}
+
+int RenderQueue::get_last_state_changes() const
+{
+    return lastStateChanges;
+}
@@ -0,0 +1,69 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include "../headers/RenderSnapshots.hpp"
+
+RenderSnapshots::RenderSnapshots()
+{
+    std::cout << "Constructed: RenderSnapshots" << std::endl;
+}
+
+RenderSnapshots::~RenderSnapshots()
+{
+    std::cout << "Deconstructed: RenderSnapshots" << std::endl;
+}
+
+RenderSnapshots::Snapshot &RenderSnapshots::begin_write()
+{
+    Snapshot &snapshot = buffers[writeIndex];
+    snapshot.sprites.clear();
+    snapshot.views.clear();
+    snapshot.entitiesTotal = 0;
+    snapshot.entitiesDrawn = 0;
+    snapshot.tick = 0;
+    return snapshot;
+}
+
+void RenderSnapshots::publish()
+{
+    buffers[writeIndex].tick = ++published;
+    // hand the written snapshot over as the ready one and take back the previous ready one to write next
+    int previous = readyIndex.exchange(writeIndex | FRESH, std::memory_order_acq_rel);
+    if (previous & FRESH)
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    writeIndex = previous & INDEX_MASK;
+}
+
+const RenderSnapshots::Snapshot &RenderSnapshots::acquire()
+{
+    if (readyIndex.load(std::memory_order_acquire) & FRESH)
+    {
+        int previous = readyIndex.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+    }
+    return buffers[readIndex];
+}
+
+void RenderSnapshots::clear()
+{
+    for (Snapshot &snapshot : buffers)
+    {
+        snapshot.sprites.clear();
+        snapshot.views.clear();
+        snapshot.tick = 0;
+    }
+    readyIndex.store(readyIndex.load() & INDEX_MASK);
+}
+
+unsigned int RenderSnapshots::get_dropped_count() const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,713 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <string>
+#include "../headers/RenderThread.hpp"
+
+RenderThread::RenderThread()
+{
+    std::cout << "Constructed: RenderThread" << std::endl;
+}
+
+RenderThread::~RenderThread()
+{
+    stop();
+    std::cout << "Deconstructed: RenderThread" << std::endl;
+}
+
+bool RenderThread::is_supported()
+{
+    const char *driver = SDL_GetCurrentVideoDriver();
+    if (driver == nullptr)
+    {
+        return false;
+    }
+    std::string name(driver);
+    return name == "windows" || name == "x11";
+}
+
+bool RenderThread::start(SDL_Window *window, Uint32 flags)
+{
+    stop();
+    this->window = window;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = false;
+        submitted = 0;
+        replayed = 0;
+    }
+    thread = std::thread(&RenderThread::thread_loop, this);
+
+    // the SDL_Renderer belongs to the thread that created it, so it's created on the render thread
+    if (!create_renderer(flags))
+    {
+        stop();
+        return false;
+    }
+    SDL_SetEventFilter(&RenderThread::filter_window_events, this);
+    reset_statistics();
+    reset_draw_state();
+    return true;
+}
+
+bool RenderThread::recreate(Uint32 flags)
+{
+    if (!thread.joinable())
+    {
+        return false;
+    }
+    flush(); // textures destroyed before recreation are destroyed on the old renderer
+    bool created = create_renderer(flags);
+    free_textures();
+    reset_draw_state();
+    next_generation();
+    return created;
+}
+
+void RenderThread::stop()
+{
+    if (!thread.joinable())
+    {
+        return;
+    }
+    SDL_SetEventFilter(nullptr, nullptr);
+    flush(); // creates and destroys recorded since the last present still run, so every handle is accounted for
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        windowEvents.clear();
+    }
+    workReady.notify_one();
+    thread.join();
+    free_textures();
+    reset_draw_state();
+    next_generation();
+}
+
+bool RenderThread::create_renderer(Uint32 flags)
+{
+    bool created{};
+    run_on_render_thread([&]()
+    {
+        created = windowRenderer.create(window, flags);
+        targetsSupported = created && windowRenderer.supports_targets();
+        if (created)
+        {
+            update_output_size();
+        }
+    });
+    return created;
+}
+
+void RenderThread::free_textures()
+{
+    // the real textures went with the renderer, only the handles are left
+    for (Texture *texture : textures)
+    {
+        delete texture;
+    }
+    textures.clear();
+}
+
+void RenderThread::thread_loop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        workReady.wait(lock, [this]()
+                       { return stopping || task || replayed != submitted; });
+        if (task)
+        {
+            // the main thread is waiting on the result, run it before queued frames
+            const std::function<void()> *function = task;
+            lock.unlock();
+            (*function)();
+            lock.lock();
+            task = nullptr;
+            workDone.notify_all();
+        }
+        else if (replayed != submitted)
+        {
+            Frame &frame = frames[replayed % FRAME_COUNT];
+            lock.unlock();
+            replay(frame); // includes the vsync wait, overlapping the main threads next tick
+            lock.lock();
+            replayed++;
+            workDone.notify_all();
+        }
+        else
+        {
+            // stopping with every queued frame drawn
+            lock.unlock();
+            windowRenderer.destroy();
+            return;
+        }
+    }
+}
+
+void RenderThread::replay(Frame &frame)
+{
+    for (const Command &command : frame.commands)
+    {
+        const SDL_Rect *rect = command.hasRect ? &command.rect : nullptr;
+        switch (command.type)
+        {
+        case CommandType::CLEAR:
+            windowRenderer.clear();
+            break;
+        case CommandType::FILL_RECTS:
+            windowRenderer.fill_rects(frame.rects.data() + command.first, static_cast<int>(command.count));
+            break;
+        case CommandType::DRAW_RECT:
+            windowRenderer.draw_rect(rect);
+            break;
+        case CommandType::DRAW_LINE:
+            windowRenderer.draw_line(command.rect.x, command.rect.y, command.rect.w, command.rect.h);
+            break;
+        case CommandType::COPY:
+            windowRenderer.copy(resolve(command.texture), command.hasSrc ? &command.src : nullptr, rect);
+            break;
+        case CommandType::GEOMETRY:
+            windowRenderer.geometry(resolve(command.texture), frame.vertices.data() + command.first, static_cast<int>(command.count),
+                                    command.indexCount > 0 ? frame.indices.data() + command.firstIndex : nullptr, command.indexCount);
+            break;
+        case CommandType::SET_DRAW_COLOR:
+            windowRenderer.set_draw_color(command.color.r, command.color.g, command.color.b, command.color.a);
+            break;
+        case CommandType::SET_DRAW_BLEND_MODE:
+            windowRenderer.set_draw_blend_mode(command.blendMode);
+            break;
+        case CommandType::SET_TARGET:
+            windowRenderer.set_target(resolve(command.texture));
+            break;
+        case CommandType::SET_VIEWPORT:
+            windowRenderer.set_viewport(rect);
+            break;
+        case CommandType::SET_CLIP_RECT:
+            windowRenderer.set_clip_rect(rect);
+            break;
+        case CommandType::CREATE_TEXTURE:
+        {
+            Texture *texture = reinterpret_cast<Texture *>(command.texture);
+            texture->texture = windowRenderer.create_texture(command.format, command.access, texture->w, texture->h);
+            if (texture->texture == nullptr)
+            {
+                std::cerr << "Error: Failed to create texture: " << SDL_GetError() << std::endl;
+            }
+            break;
+        }
+        case CommandType::CREATE_TEXTURE_FROM_SURFACE:
+        {
+            Texture *texture = reinterpret_cast<Texture *>(command.texture);
+            texture->texture = windowRenderer.create_texture_from_surface(command.surface);
+            if (texture->texture == nullptr)
+            {
+                std::cerr << "Error: Failed to create texture from surface: " << SDL_GetError() << std::endl;
+            }
+            SDL_FreeSurface(command.surface);
+            break;
+        }
+        case CommandType::UPDATE_TEXTURE:
+            windowRenderer.update_texture(resolve(command.texture), rect, frame.pixels.data() + command.first, command.pitch[0]);
+            break;
+        case CommandType::UPDATE_YUV_TEXTURE:
+        {
+            // planes were copied one after another, U and V have half the rows of Y
+            const Uint8 *yPlane = frame.pixels.data() + command.first;
+            const Uint8 *uPlane = yPlane + static_cast<size_t>(command.pitch[0]) * command.rect.h;
+            const Uint8 *vPlane = uPlane + static_cast<size_t>(command.pitch[1]) * ((command.rect.h + 1) / 2);
+            windowRenderer.update_yuv_texture(resolve(command.texture), rect, yPlane, command.pitch[0], uPlane, command.pitch[1], vPlane, command.pitch[2]);
+            break;
+        }
+        case CommandType::SET_TEXTURE_BLEND_MODE:
+            windowRenderer.set_texture_blend_mode(resolve(command.texture), command.blendMode);
+            break;
+        case CommandType::DESTROY_TEXTURE:
+            windowRenderer.destroy_texture(resolve(command.texture));
+            delete reinterpret_cast<Texture *>(command.texture);
+            break;
+        }
+    }
+    if (frame.present)
+    {
+        windowRenderer.present();
+        update_output_size();
+    }
+
+    // clear keeps the capacity so recording the frame again doesn't allocate
+    frame.commands.clear();
+    frame.rects.clear();
+    frame.vertices.clear();
+    frame.indices.clear();
+    frame.pixels.clear();
+    frame.present = false;
+}
+
+void RenderThread::update_output_size()
+{
+    int w{}, h{};
+    windowRenderer.get_output_size(&w, &h);
+    outputWidth = w;
+    outputHeight = h;
+}
+
+void RenderThread::run_on_render_thread(const std::function<void()> &function)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    task = &function;
+    workReady.notify_one();
+    workDone.wait(lock, [this]()
+                  { return task == nullptr; });
+}
+
+void RenderThread::forward_window_events()
+{
+    std::vector<SDL_Event> events{};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.swap(windowEvents);
+    }
+    if (events.empty() || !thread.joinable())
+    {
+        return;
+    }
+    run_on_render_thread([&]()
+    {
+        // SDL's renderer event watch runs on the pushing thread, here the one using the renderer
+        for (SDL_Event &event : events)
+        {
+            SDL_PushEvent(&event);
+        }
+    });
+}
+
+void RenderThread::set_window_event_callback(std::function<void()> callback)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    onWindowEvent = callback;
+}
+
+int RenderThread::filter_window_events(void *userdata, SDL_Event *event)
+{
+    RenderThread *renderThread = static_cast<RenderThread *>(userdata);
+    if (event->type != SDL_WINDOWEVENT || std::this_thread::get_id() == renderThread->thread.get_id())
+    {
+        return 1;
+    }
+    std::function<void()> callback{};
+    {
+        std::lock_guard<std::mutex> lock(renderThread->mutex);
+        renderThread->windowEvents.push_back(*event);
+        callback = renderThread->onWindowEvent;
+    }
+    if (callback)
+    {
+        callback();
+    }
+    return 0; // not queued and not seen by the event watches until forward_window_events()
+}
+
+void RenderThread::submit(bool present)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    frames[submitted % FRAME_COUNT].present = present;
+    submitted++;
+    workReady.notify_one();
+    // the next frame to record is free once the render thread is at most FRAME_COUNT - 1 frames behind
+    workDone.wait(lock, [this]()
+                  { return submitted - replayed < FRAME_COUNT; });
+}
+
+void RenderThread::flush()
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return;
+    }
+    if (!frame->commands.empty())
+    {
+        submit(false);
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [this]()
+                  { return replayed == submitted; });
+}
+
+void RenderThread::reset_draw_state()
+{
+    target = nullptr;
+    viewport = {};
+    drawColor = {0, 0, 0, 255};
+    drawBlendMode = SDL_BLENDMODE_NONE;
+}
+
+RenderThread::Frame *RenderThread::recording()
+{
+    if (!thread.joinable())
+    {
+        return nullptr;
+    }
+    return &frames[submitted % FRAME_COUNT];
+}
+
+RenderThread::Texture *RenderThread::find_texture(SDL_Texture *texture, const char *caller) const
+{
+    // the handle is only ever a Texture this backend allocated, check before using it as one
+    Texture *found = reinterpret_cast<Texture *>(texture);
+    if (texture == nullptr || textures.count(found) == 0)
+    {
+        std::cerr << "Error: " << caller << ": not a live texture of the render thread" << std::endl;
+        return nullptr;
+    }
+    return found;
+}
+
+SDL_Texture *RenderThread::resolve(SDL_Texture *texture)
+{
+    return texture ? reinterpret_cast<Texture *>(texture)->texture : nullptr;
+}
+
+RenderThread::Command &RenderThread::record(Frame &frame, CommandType type, SDL_Texture *texture, const SDL_Rect *rect)
+{
+    frame.commands.emplace_back();
+    Command &command = frame.commands.back();
+    command.type = type;
+    command.texture = texture;
+    if (rect)
+    {
+        command.rect = *rect;
+        command.hasRect = true;
+    }
+    return command;
+}
+
+int RenderThread::draw_clear()
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    record(*frame, CommandType::CLEAR, nullptr, nullptr);
+    return 0;
+}
+
+int RenderThread::draw_fill_rects(const SDL_Rect *rects, int count)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || count <= 0)
+    {
+        return frame ? 0 : -1;
+    }
+    Command &command = record(*frame, CommandType::FILL_RECTS, nullptr, nullptr);
+    command.first = frame->rects.size();
+    command.count = static_cast<size_t>(count);
+    frame->rects.insert(frame->rects.end(), rects, rects + count);
+    return 0;
+}
+
+int RenderThread::draw_outline_rect(const SDL_Rect *rect)
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    record(*frame, CommandType::DRAW_RECT, nullptr, rect);
+    return 0;
+}
+
+int RenderThread::draw_line_segment(int x1, int y1, int x2, int y2)
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    Command &command = record(*frame, CommandType::DRAW_LINE, nullptr, nullptr);
+    command.rect = {x1, y1, x2, y2};
+    return 0;
+}
+
+int RenderThread::draw_copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || find_texture(texture, "copy") == nullptr)
+    {
+        return -1;
+    }
+    Command &command = record(*frame, CommandType::COPY, texture, dst);
+    if (src)
+    {
+        command.src = *src;
+        command.hasSrc = true;
+    }
+    return 0;
+}
+
+int RenderThread::draw_geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || (texture && find_texture(texture, "geometry") == nullptr))
+    {
+        return -1;
+    }
+    if (vertexCount <= 0)
+    {
+        return 0;
+    }
+    Command &command = record(*frame, CommandType::GEOMETRY, texture, nullptr);
+    command.first = frame->vertices.size();
+    command.count = static_cast<size_t>(vertexCount);
+    frame->vertices.insert(frame->vertices.end(), vertices, vertices + vertexCount);
+    if (indices && indexCount > 0)
+    {
+        command.firstIndex = frame->indices.size();
+        command.indexCount = indexCount;
+        frame->indices.insert(frame->indices.end(), indices, indices + indexCount);
+    }
+    return 0;
+}
+
+void RenderThread::present_frame()
+{
+    if (recording())
+    {
+        submit(true);
+    }
+}
+
+int RenderThread::set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    drawColor = {r, g, b, a};
+    record(*frame, CommandType::SET_DRAW_COLOR, nullptr, nullptr).color = drawColor;
+    return 0;
+}
+
+int RenderThread::get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a)
+{
+    *r = drawColor.r;
+    *g = drawColor.g;
+    *b = drawColor.b;
+    *a = drawColor.a;
+    return 0;
+}
+
+int RenderThread::set_draw_blend_mode(SDL_BlendMode blendMode)
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    drawBlendMode = blendMode;
+    record(*frame, CommandType::SET_DRAW_BLEND_MODE, nullptr, nullptr).blendMode = blendMode;
+    return 0;
+}
+
+int RenderThread::get_draw_blend_mode(SDL_BlendMode *blendMode)
+{
+    *blendMode = drawBlendMode;
+    return 0;
+}
+
+int RenderThread::set_target(SDL_Texture *texture)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || (texture && find_texture(texture, "set_target") == nullptr))
+    {
+        return -1;
+    }
+    target = texture;
+    viewport = {}; // like SDL a new target starts with the whole target as its viewport
+    record(*frame, CommandType::SET_TARGET, texture, nullptr);
+    return 0;
+}
+
+SDL_Texture *RenderThread::get_target()
+{
+    return target;
+}
+
+int RenderThread::set_viewport(const SDL_Rect *rect)
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    viewport = rect ? *rect : SDL_Rect{};
+    record(*frame, CommandType::SET_VIEWPORT, nullptr, rect);
+    return 0;
+}
+
+void RenderThread::get_viewport(SDL_Rect *rect)
+{
+    if (viewport.w > 0 && viewport.h > 0)
+    {
+        *rect = viewport;
+        return;
+    }
+    if (target)
+    {
+        Texture *texture = reinterpret_cast<Texture *>(target);
+        *rect = {0, 0, texture->w, texture->h};
+        return;
+    }
+    *rect = {0, 0, outputWidth.load(), outputHeight.load()};
+}
+
+int RenderThread::set_clip_rect(const SDL_Rect *rect)
+{
+    Frame *frame = recording();
+    if (frame == nullptr)
+    {
+        return -1;
+    }
+    record(*frame, CommandType::SET_CLIP_RECT, nullptr, rect);
+    return 0;
+}
+
+int RenderThread::get_output_size(int *w, int *h)
+{
+    if (w)
+    {
+        *w = outputWidth;
+    }
+    if (h)
+    {
+        *h = outputHeight;
+    }
+    return 0;
+}
+
+SDL_Texture *RenderThread::create_texture(Uint32 format, int access, int w, int h)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || w <= 0 || h <= 0)
+    {
+        std::cerr << "Error: Failed to create texture: render thread not started or size " << w << "x" << h << std::endl;
+        return nullptr;
+    }
+    if (access == SDL_TEXTUREACCESS_TARGET && !targetsSupported)
+    {
+        return nullptr; // like SDL, callers fall back to drawing without a target
+    }
+    // the handle is usable straight away, the render thread creates the texture before any command using it
+    Texture *texture = new Texture{nullptr, w, h};
+    textures.insert(texture);
+    Command &command = record(*frame, CommandType::CREATE_TEXTURE, reinterpret_cast<SDL_Texture *>(texture), nullptr);
+    command.format = format;
+    command.access = access;
+    return reinterpret_cast<SDL_Texture *>(texture);
+}
+
+SDL_Texture *RenderThread::create_texture_from_surface(SDL_Surface *surface)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || surface == nullptr)
+    {
+        return nullptr;
+    }
+    SDL_Surface *copy = SDL_DuplicateSurface(surface);
+    if (copy == nullptr)
+    {
+        std::cerr << "Error: Failed to create texture from surface: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    Texture *texture = new Texture{nullptr, surface->w, surface->h};
+    textures.insert(texture);
+    record(*frame, CommandType::CREATE_TEXTURE_FROM_SURFACE, reinterpret_cast<SDL_Texture *>(texture), nullptr).surface = copy;
+    return reinterpret_cast<SDL_Texture *>(texture);
+}
+
+int RenderThread::update_texture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    Frame *frame = recording();
+    Texture *found = find_texture(texture, "update_texture");
+    if (frame == nullptr || found == nullptr || pixels == nullptr)
+    {
+        return -1;
+    }
+    SDL_Rect area = rect ? *rect : SDL_Rect{0, 0, found->w, found->h};
+    size_t bytes = static_cast<size_t>(pitch) * area.h;
+
+    // copied so the caller can reuse the pixels before the render thread gets to the update
+    Command &command = record(*frame, CommandType::UPDATE_TEXTURE, texture, rect);
+    command.first = frame->pixels.size();
+    command.count = bytes;
+    command.pitch[0] = pitch;
+    const Uint8 *bytesIn = static_cast<const Uint8 *>(pixels);
+    frame->pixels.insert(frame->pixels.end(), bytesIn, bytesIn + bytes);
+    return 0;
+}
+
+int RenderThread::update_yuv_texture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *yPlane, int yPitch, const Uint8 *uPlane, int uPitch, const Uint8 *vPlane, int vPitch)
+{
+    Frame *frame = recording();
+    Texture *found = find_texture(texture, "update_yuv_texture");
+    if (frame == nullptr || found == nullptr)
+    {
+        return -1;
+    }
+    SDL_Rect area = rect ? *rect : SDL_Rect{0, 0, found->w, found->h};
+    size_t yBytes = static_cast<size_t>(yPitch) * area.h;
+    size_t uBytes = static_cast<size_t>(uPitch) * ((area.h + 1) / 2);
+    size_t vBytes = static_cast<size_t>(vPitch) * ((area.h + 1) / 2);
+
+    Command &command = record(*frame, CommandType::UPDATE_YUV_TEXTURE, texture, rect);
+    command.rect = area; // replay() needs the rows of each plane even when rect is nullptr
+    command.first = frame->pixels.size();
+    command.count = yBytes + uBytes + vBytes;
+    command.pitch[0] = yPitch;
+    command.pitch[1] = uPitch;
+    command.pitch[2] = vPitch;
+    frame->pixels.insert(frame->pixels.end(), yPlane, yPlane + yBytes);
+    frame->pixels.insert(frame->pixels.end(), uPlane, uPlane + uBytes);
+    frame->pixels.insert(frame->pixels.end(), vPlane, vPlane + vBytes);
+    return 0;
+}
+
+int RenderThread::set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode)
+{
+    Frame *frame = recording();
+    if (frame == nullptr || find_texture(texture, "set_texture_blend_mode") == nullptr)
+    {
+        return -1;
+    }
+    record(*frame, CommandType::SET_TEXTURE_BLEND_MODE, texture, nullptr).blendMode = blendMode;
+    return 0;
+}
+
+void RenderThread::destroy_texture(SDL_Texture *texture)
+{
+    Frame *frame = recording();
+    if (texture == nullptr || frame == nullptr)
+    {
+        return;
+    }
+    Texture *found = find_texture(texture, "destroy_texture");
+    if (found == nullptr)
+    {
+        return;
+    }
+    // destroyed in order after the draws already recorded with it, the render thread frees the handle
+    textures.erase(found);
+    if (texture == target)
+    {
+        target = nullptr;
+    }
+    record(*frame, CommandType::DESTROY_TEXTURE, texture, nullptr);
+}
@@ -0,0 +1,81 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include "../headers/SoundBank.hpp"
+
+SoundBank::SoundBank()
+{
+    std::cout << "Constructed: SoundBank" << std::endl;
+}
+
+SoundBank::~SoundBank()
+{
+    std::cout << "Deconstructed: SoundBank" << std::endl;
+}
+
+Mix_Chunk *SoundBank::acquire(const std::string &filePath)
+{
+    auto found = sounds.find(filePath);
+    if (found != sounds.end())
+    {
+        found->second.references++;
+        return found->second.chunk;
+    }
+
+    Sound sound{};
+    sound.chunk = Mix_LoadWAV(filePath.c_str());
+    sound.references = 1;
+    loadCount++;
+    if (sound.chunk == nullptr)
+    {
+        std::cerr << "Error: Failed to load sound: " << filePath << ": " << Mix_GetError() << std::endl;
+    }
+    sounds[filePath] = sound;
+    return sound.chunk;
+}
+
+void SoundBank::release(const std::string &filePath)
+{
+    auto found = sounds.find(filePath);
+    if (found == sounds.end())
+    {
+        return; // already freed by clear()
+    }
+    if (--found->second.references > 0)
+    {
+        return;
+    }
+    if (found->second.chunk)
+    {
+        Mix_FreeChunk(found->second.chunk);
+    }
+    sounds.erase(found);
+}
+
+void SoundBank::clear()
+{
+    for (auto &entry : sounds)
+    {
+        if (entry.second.chunk)
+        {
+            Mix_FreeChunk(entry.second.chunk);
+        }
+    }
+    sounds.clear();
+}
+
+size_t SoundBank::get_sound_count() const
+{
+    return sounds.size();
+}
+
+unsigned long long SoundBank::get_load_count() const
+{
+    return loadCount;
+}
@@ -0,0 +1,92 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::max/min, std::sort, std::unique
+#include "../headers/SpatialGrid.hpp"
+
+SpatialGrid::SpatialGrid(int cellSize) : cellSize(std::max(1, cellSize))
+{
+    std::cout << "Constructed: SpatialGrid" << std::endl;
+}
+
+SpatialGrid::~SpatialGrid()
+{
+    std::cout << "Deconstructed: SpatialGrid" << std::endl;
+}
+
+void SpatialGrid::rebuild(const std::vector<Entity *> &entities, int gameWorldWidth, int gameWorldHeight)
+{
+    int newColumns = std::max(1, (gameWorldWidth + cellSize - 1) / cellSize);
+    int newRows = std::max(1, (gameWorldHeight + cellSize - 1) / cellSize);
+    if (newColumns != columns || newRows != rows)
+    {
+        columns = newColumns;
+        rows = newRows;
+        cells.assign(static_cast<size_t>(columns * rows), {});
+    }
+    for (std::vector<Entity *> &cell : cells)
+    {
+        cell.clear();
+    }
+
+    for (Entity *e : entities)
+    {
+        SDL_Rect rect = e->get_rect();
+        // entities are kept inside the game world, clamp anyway so nothing is lost off the edge
+        int firstColumn = std::min(columns - 1, std::max(0, rect.x / cellSize));
+        int firstRow = std::min(rows - 1, std::max(0, rect.y / cellSize));
+        int lastColumn = std::min(columns - 1, std::max(firstColumn, (rect.x + rect.w) / cellSize));
+        int lastRow = std::min(rows - 1, std::max(firstRow, (rect.y + rect.h) / cellSize));
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int column = firstColumn; column <= lastColumn; column++)
+            {
+                cells[row * columns + column].push_back(e);
+            }
+        }
+    }
+}
+
+void SpatialGrid::query(const SDL_Rect &area, std::vector<Entity *> &found) const
+{
+    found.clear();
+    if (cells.empty())
+    {
+        return;
+    }
+    int firstColumn = std::max(0, area.x / cellSize);
+    int firstRow = std::max(0, area.y / cellSize);
+    int lastColumn = std::min(columns - 1, (area.x + area.w) / cellSize);
+    int lastRow = std::min(rows - 1, (area.y + area.h) / cellSize);
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        for (int column = firstColumn; column <= lastColumn; column++)
+        {
+            for (Entity *e : cells[row * columns + column])
+            {
+                SDL_Rect rect = e->get_rect();
+                if (SDL_HasIntersection(&rect, &area))
+                {
+                    found.push_back(e);
+                }
+            }
+        }
+    }
+    // entities spanning several cells are found once per cell
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+}
+
+void SpatialGrid::clear()
+{
+    for (std::vector<Entity *> &cell : cells)
+    {
+        cell.clear();
+    }
+}
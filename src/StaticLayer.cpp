@@ -0,0 +1,203 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::max/min
+#include "../headers/StaticLayer.hpp"
+
+StaticLayer::StaticLayer(int chunkSize) : chunkSize(std::max(1, chunkSize))
+{
+    std::cout << "Constructed: StaticLayer" << std::endl;
+}
+
+StaticLayer::~StaticLayer()
+{
+    std::cout << "Deconstructed: StaticLayer" << std::endl;
+}
+
+void StaticLayer::resize_grid(int width, int height)
+{
+    clear();
+    worldWidth = width;
+    worldHeight = height;
+    columns = (width + chunkSize - 1) / chunkSize;
+    rows = (height + chunkSize - 1) / chunkSize;
+    chunks.assign(static_cast<size_t>(std::max(0, columns * rows)), Chunk{});
+}
+
+void StaticLayer::mark_dirty(const SDL_Rect &worldRect)
+{
+    revision++;
+    if (chunks.empty())
+    {
+        return;
+    }
+    int firstColumn = std::max(0, worldRect.x / chunkSize);
+    int firstRow = std::max(0, worldRect.y / chunkSize);
+    int lastColumn = std::min(columns - 1, (worldRect.x + worldRect.w) / chunkSize);
+    int lastRow = std::min(rows - 1, (worldRect.y + worldRect.h) / chunkSize);
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        for (int column = firstColumn; column <= lastColumn; column++)
+        {
+            chunks[row * columns + column].dirty = true;
+        }
+    }
+}
+
+void StaticLayer::update(const std::vector<Entity *> &entities, const std::function<bool(Entity *)> &isStatic)
+{
+    updateCount++;
+    for (Entity *e : entities)
+    {
+        if (!isStatic(e))
+        {
+            continue;
+        }
+        SDL_Rect rect = e->get_rect();
+        auto found = bakedEntities.find(e);
+        if (found == bakedEntities.end())
+        {
+            bakedEntities[e] = BakedEntity{rect, updateCount};
+            mark_dirty(rect);
+            continue;
+        }
+        BakedEntity &baked = found->second;
+        if (baked.rect.x != rect.x || baked.rect.y != rect.y || baked.rect.w != rect.w || baked.rect.h != rect.h)
+        {
+            // e.g. pushed apart from an overlapping obstacle
+            mark_dirty(baked.rect);
+            mark_dirty(rect);
+            baked.rect = rect;
+        }
+        baked.seen = updateCount;
+    }
+
+    // entities that were removed from the scene
+    for (auto it = bakedEntities.begin(); it != bakedEntities.end();)
+    {
+        if (it->second.seen != updateCount)
+        {
+            mark_dirty(it->second.rect);
+            it = bakedEntities.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void StaticLayer::bake_chunk(RenderBackend *renderer, Chunk &chunk, int column, int row)
+{
+    SDL_Rect chunkRect = {column * chunkSize, row * chunkSize, chunkSize, chunkSize};
+
+    SDL_Texture *previousTarget = renderer->get_target();
+    renderer->set_target(chunk.texture);
+    renderer->set_draw_color(0, 0, 0, 0); // transparent, the background shows between the entities
+    renderer->clear();
+
+    for (auto &pair : bakedEntities)
+    {
+        if (SDL_HasIntersection(&pair.second.rect, &chunkRect))
+        {
+            pair.first->render_texture(pair.second.rect.x - chunkRect.x, pair.second.rect.y - chunkRect.y);
+        }
+    }
+
+    renderer->set_target(previousTarget);
+    chunk.dirty = false;
+}
+
+bool StaticLayer::draw(RenderBackend *renderer, const SDL_Rect &viewRect, int gameWorldWidth, int gameWorldHeight)
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::STATIC_CHUNKS);
+    if (gameWorldWidth != worldWidth || gameWorldHeight != worldHeight)
+    {
+        resize_grid(gameWorldWidth, gameWorldHeight);
+    }
+    chunksDrawn = 0;
+    available = false;
+    if (chunks.empty())
+    {
+        return false;
+    }
+
+    int firstColumn = std::max(0, viewRect.x / chunkSize);
+    int firstRow = std::max(0, viewRect.y / chunkSize);
+    int lastColumn = std::min(columns - 1, (viewRect.x + viewRect.w - 1) / chunkSize);
+    int lastRow = std::min(rows - 1, (viewRect.y + viewRect.h - 1) / chunkSize);
+
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        for (int column = firstColumn; column <= lastColumn; column++)
+        {
+            Chunk &chunk = chunks[row * columns + column];
+            if (chunk.texture == nullptr)
+            {
+                this->renderer = renderer;
+                chunk.texture = renderer->create_texture(SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, chunkSize, chunkSize);
+                if (chunk.texture == nullptr)
+                {
+                    std::cerr << "Error: Failed to create static layer chunk: " << SDL_GetError() << std::endl;
+                    return false;
+                }
+                renderer->set_texture_blend_mode(chunk.texture, SDL_BLENDMODE_BLEND); // drawn over the background
+                chunk.dirty = true;
+            }
+            if (chunk.dirty)
+            {
+                bake_chunk(renderer, chunk, column, row);
+            }
+            SDL_Rect chunkRect = {column * chunkSize - viewRect.x, row * chunkSize - viewRect.y, chunkSize, chunkSize};
+            renderer->copy(chunk.texture, nullptr, &chunkRect);
+            chunksDrawn++;
+        }
+    }
+    available = true;
+    return true;
+}
+
+bool StaticLayer::is_baked(Entity *e) const
+{
+    return available && bakedEntities.find(e) != bakedEntities.end();
+}
+
+void StaticLayer::invalidate()
+{
+    revision++;
+    bakedEntities.clear();
+    for (Chunk &chunk : chunks)
+    {
+        chunk.dirty = true;
+    }
+}
+
+void StaticLayer::clear()
+{
+    for (Chunk &chunk : chunks)
+    {
+        if (chunk.texture)
+        {
+            renderer->destroy_texture(chunk.texture);
+            chunk.texture = nullptr;
+        }
+        chunk.dirty = true;
+    }
+    available = false;
+}
+
+int StaticLayer::get_chunks_drawn() const
+{
+    return chunksDrawn;
+}
+
+unsigned int StaticLayer::get_revision() const
+{
+    return revision;
+}
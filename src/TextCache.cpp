@@ -0,0 +1,115 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include "../headers/TextCache.hpp"
+
+TextCache::TextCache(size_t budgetBytes) : budgetBytes(budgetBytes)
+{
+    std::cout << "Constructed: TextCache" << std::endl;
+}
+
+TextCache::~TextCache()
+{
+    std::cout << "Deconstructed: TextCache" << std::endl;
+}
+
+SDL_Texture *TextCache::get_texture(RenderBackend *renderer, const std::string &text, TTF_Font *font, SDL_Color color, int &width, int &height)
+{
+    TextKey key{text, font, (Uint32(color.r) << 24) | (Uint32(color.g) << 16) | (Uint32(color.b) << 8) | Uint32(color.a)};
+
+    auto found = lookup.find(key);
+    if (found != lookup.end())
+    {
+        // move to front as most recently used
+        entries.splice(entries.begin(), entries, found->second);
+        width = found->second->width;
+        height = found->second->height;
+        frameHits++;
+        return found->second->texture;
+    }
+
+    frameMisses++;
+    SDL_Surface *textSurface = TTF_RenderUTF8_Blended(font, text.c_str(), color);
+    if (textSurface == nullptr)
+    {
+        return nullptr;
+    }
+
+    // surface dimensions are the rendered UTF-8 size, no need to measure the string again
+    width = textSurface->w;
+    height = textSurface->h;
+    this->renderer = renderer;
+    SDL_Texture *textTexture = renderer->create_texture_from_surface(textSurface);
+    SDL_FreeSurface(textSurface);
+    if (textTexture == nullptr)
+    {
+        std::cerr << "Error: Failed to create text texture: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    size_t bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    entries.push_front(TextEntry{key, textTexture, width, height, bytes});
+    lookup[key] = entries.begin();
+    usedBytes += bytes;
+    evict_to_budget();
+
+    return textTexture;
+}
+
+void TextCache::evict_to_budget()
+{
+    // never evict the entry that was just added at the front
+    while (usedBytes > budgetBytes && entries.size() > 1)
+    {
+        TextEntry &oldest = entries.back();
+        renderer->destroy_texture(oldest.texture);
+        usedBytes -= oldest.bytes;
+        lookup.erase(oldest.key);
+        entries.pop_back();
+    }
+}
+
+void TextCache::clear()
+{
+    for (TextEntry &entry : entries)
+    {
+        renderer->destroy_texture(entry.texture);
+    }
+    entries.clear();
+    lookup.clear();
+    usedBytes = 0;
+}
+
+void TextCache::begin_frame()
+{
+    lastFrameHits = frameHits;
+    lastFrameMisses = frameMisses;
+    frameHits = 0;
+    frameMisses = 0;
+}
+
+int TextCache::get_last_frame_hits() const
+{
+    return lastFrameHits;
+}
+
+int TextCache::get_last_frame_misses() const
+{
+    return lastFrameMisses;
+}
+
+size_t TextCache::get_used_bytes() const
+{
+    return usedBytes;
+}
+
+size_t TextCache::get_entry_count() const
+{
+    return entries.size();
+}
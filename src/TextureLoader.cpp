@@ -0,0 +1,207 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <SDL2/SDL_image.h>
+#include "../headers/TextureLoader.hpp"
+
+TextureLoader::TextureLoader(size_t uploadBudget) : uploadBudget(uploadBudget)
+{
+    std::cout << "Constructed: TextureLoader" << std::endl;
+}
+
+TextureLoader::~TextureLoader()
+{
+    stop();
+    std::cout << "Deconstructed: TextureLoader" << std::endl;
+}
+
+void TextureLoader::start(int workerCount)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = false;
+    for (int i = static_cast<int>(workers.size()); i < workerCount; i++)
+    {
+        workers.emplace_back(&TextureLoader::worker_loop, this);
+    }
+}
+
+void TextureLoader::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    requestReady.notify_all();
+    for (std::thread &worker : workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    workers.clear();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (Decoded &image : decoded)
+    {
+        SDL_FreeSurface(image.surface);
+    }
+    decoded.clear();
+    requests.clear();
+}
+
+void TextureLoader::set_decoded_callback(std::function<void()> callback)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    onDecoded = callback;
+}
+
+void TextureLoader::worker_loop()
+{
+    while (true)
+    {
+        Request request{};
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            requestReady.wait(lock, [this]()
+                              { return stopping || !requests.empty(); });
+            if (stopping)
+            {
+                return;
+            }
+            request = requests.front();
+            requests.pop_front();
+            busyWorkers++;
+        }
+
+        // disk read and image decode happen here, off the main thread
+        SDL_Surface *surface = IMG_Load(request.path.c_str());
+
+        std::function<void()> callback{};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            decoded.push_back(Decoded{request.id, request.path, surface});
+            busyWorkers--;
+            callback = onDecoded;
+        }
+        workerIdle.notify_all();
+        if (callback)
+        {
+            callback();
+        }
+    }
+}
+
+SDL_Texture *TextureLoader::get_placeholder(RenderBackend *renderer)
+{
+    if (placeholder && placeholderRenderer == renderer)
+    {
+        return placeholder;
+    }
+    placeholder = renderer->create_texture(SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 1, 1);
+    placeholderRenderer = renderer;
+    if (placeholder)
+    {
+        Uint32 transparent = 0;
+        renderer->update_texture(placeholder, nullptr, &transparent, sizeof(transparent));
+        renderer->set_texture_blend_mode(placeholder, SDL_BLENDMODE_BLEND);
+    }
+    return placeholder;
+}
+
+SDL_Texture *TextureLoader::load(RenderBackend *renderer, const std::string &filePath, std::function<void(SDL_Texture *)> onLoaded)
+{
+    unsigned int id = nextId++;
+    callbacks[id] = onLoaded;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (workers.empty())
+    {
+        // no worker threads, decode here and upload with the next upload() like a threaded load
+        lock.unlock();
+        SDL_Surface *surface = IMG_Load(filePath.c_str());
+        lock.lock();
+        decoded.push_back(Decoded{id, filePath, surface});
+    }
+    else
+    {
+        requests.push_back(Request{id, filePath});
+        lock.unlock();
+        requestReady.notify_one();
+    }
+    return get_placeholder(renderer);
+}
+
+int TextureLoader::upload(RenderBackend *renderer)
+{
+    int uploaded{};
+    size_t uploadedBytes{};
+    while (uploaded == 0 || uploadedBytes < uploadBudget)
+    {
+        Decoded image{};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (decoded.empty())
+            {
+                break;
+            }
+            image = decoded.front();
+            decoded.pop_front();
+        }
+
+        SDL_Texture *texture{};
+        if (image.surface)
+        {
+            texture = renderer->create_texture_from_surface(image.surface);
+            uploadedBytes += static_cast<size_t>(image.surface->pitch) * image.surface->h;
+            SDL_FreeSurface(image.surface);
+        }
+        if (!texture)
+        {
+            std::cerr << "Error: Failed to load texture: " << image.path << ": " << IMG_GetError() << std::endl;
+        }
+
+        auto found = callbacks.find(image.id);
+        if (found != callbacks.end())
+        {
+            std::function<void(SDL_Texture *)> onLoaded = found->second;
+            callbacks.erase(found);
+            if (onLoaded)
+            {
+                onLoaded(texture);
+            }
+        }
+        uploaded++;
+    }
+    return uploaded;
+}
+
+void TextureLoader::finish(RenderBackend *renderer)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        workerIdle.wait(lock, [this]()
+                        { return workers.empty() || (requests.empty() && busyWorkers == 0); });
+    }
+    while (upload(renderer) > 0)
+    {
+    }
+
+    if (placeholder)
+    {
+        renderer->destroy_texture(placeholder);
+        placeholder = nullptr;
+        placeholderRenderer = nullptr;
+    }
+}
+
+size_t TextureLoader::get_pending_count() const
+{
+    return callbacks.size();
+}
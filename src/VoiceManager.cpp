@@ -0,0 +1,294 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include <algorithm> // for std::max, std::stable_sort
+#include <cmath>     // for std::sqrt, std::atan2
+#include <limits>    // for std::numeric_limits in play_at()
+#include "../headers/VoiceManager.hpp"
+
+VoiceManager::VoiceManager(int channelCount, int defaultMaxVoices, float audibleRadius) : channelCount(channelCount), defaultMaxVoices(defaultMaxVoices), audibleRadius(audibleRadius)
+{
+    std::cout << "Constructed: VoiceManager" << std::endl;
+}
+
+VoiceManager::~VoiceManager()
+{
+    std::cout << "Deconstructed: VoiceManager" << std::endl;
+}
+
+void VoiceManager::open()
+{
+    channelCount = Mix_AllocateChannels(channelCount);
+    voices.assign(static_cast<size_t>(std::max(0, channelCount)), Voice{});
+}
+
+VoiceManager::SoundLimit VoiceManager::get_limit(Mix_Chunk *chunk) const
+{
+    auto found = limits.find(chunk);
+    if (found != limits.end())
+    {
+        return found->second;
+    }
+    return {defaultMaxVoices, SoundPriority::NORMAL};
+}
+
+void VoiceManager::set_sound_limit(Mix_Chunk *chunk, int maxVoices, SoundPriority priority)
+{
+    if (chunk)
+    {
+        limits[chunk] = {maxVoices, priority};
+    }
+}
+
+void VoiceManager::set_volume(int volume)
+{
+    volume = std::max(0, std::min(MIX_MAX_VOLUME, volume));
+    if (volume == masterVolume)
+    {
+        return;
+    }
+    masterVolume = volume;
+    for (size_t channel = 0; channel < voices.size(); channel++)
+    {
+        if (voices[channel].chunk)
+        {
+            Mix_Volume(static_cast<int>(channel), voices[channel].volume * masterVolume / MIX_MAX_VOLUME);
+        }
+    }
+}
+
+int VoiceManager::get_loudness(int volume, Uint8 distance)
+{
+    return volume * (255 - distance);
+}
+
+void VoiceManager::queue(const Request &request)
+{
+    requestedCount++;
+    for (Request &queued : pending)
+    {
+        if (queued.chunk == request.chunk)
+        {
+            if (get_loudness(request.volume, request.distance) > get_loudness(queued.volume, queued.distance))
+            {
+                queued = request; // the nearest or loudest request is the one heard
+            }
+            coalescedCount++;
+            return;
+        }
+    }
+    pending.push_back(request);
+}
+
+void VoiceManager::play(Mix_Chunk *chunk, int volume)
+{
+    if (chunk)
+    {
+        queue({chunk, volume});
+    }
+}
+
+void VoiceManager::set_listener(float x, float y)
+{
+    listeners.clear();
+    listeners.push_back({x, y});
+}
+
+void VoiceManager::add_listener(float x, float y)
+{
+    listeners.push_back({x, y});
+}
+
+void VoiceManager::play_at(Mix_Chunk *chunk, float x, float y, int volume)
+{
+    if (chunk == nullptr)
+    {
+        return;
+    }
+    if (listeners.empty())
+    {
+        play(chunk, volume);
+        return;
+    }
+
+    // heard by the nearest listener, e.g. the split-screen view it happened in
+    float dx{}, dy{};
+    float distanceSquared = std::numeric_limits<float>::max();
+    for (const Listener &listener : listeners)
+    {
+        float listenerDx = x - listener.x;
+        float listenerDy = y - listener.y;
+        if (listenerDx * listenerDx + listenerDy * listenerDy < distanceSquared)
+        {
+            dx = listenerDx;
+            dy = listenerDy;
+            distanceSquared = dx * dx + dy * dy;
+        }
+    }
+    if (distanceSquared >= audibleRadius * audibleRadius)
+    {
+        requestedCount++;
+        culledCount++; // too far to hear, never reaches the mixer
+        return;
+    }
+
+    Request request{chunk, volume, true};
+    request.distance = static_cast<Uint8>(std::sqrt(distanceSquared) / audibleRadius * 255.0f);
+    // Mix_SetPosition angles go clockwise from straight ahead, screen up is ahead and screen right is 90
+    int angle = static_cast<int>(std::atan2(dx, -dy) * 180.0f / 3.14159265f);
+    request.angle = static_cast<Sint16>((angle + 360) % 360);
+    queue(request);
+}
+
+int VoiceManager::find_channel(SoundPriority priority) const
+{
+    int victim = -1;
+    for (size_t channel = 0; channel < voices.size(); channel++)
+    {
+        const Voice &voice = voices[channel];
+        if (voice.chunk == nullptr)
+        {
+            return static_cast<int>(channel);
+        }
+        if (voice.priority > priority)
+        {
+            continue;
+        }
+        if (victim < 0)
+        {
+            victim = static_cast<int>(channel);
+            continue;
+        }
+        // lowest priority, then quietest as heard, then oldest
+        const Voice &best = voices[victim];
+        int loudness = get_loudness(voice.volume, voice.distance);
+        int bestLoudness = get_loudness(best.volume, best.distance);
+        if (voice.priority != best.priority ? voice.priority < best.priority
+            : loudness != bestLoudness ? loudness < bestLoudness
+            : voice.started < best.started)
+        {
+            victim = static_cast<int>(channel);
+        }
+    }
+    return victim;
+}
+
+void VoiceManager::flush()
+{
+    if (pending.empty())
+    {
+        return;
+    }
+
+    // voices that finished since the last flush free their channel
+    for (size_t channel = 0; channel < voices.size(); channel++)
+    {
+        if (voices[channel].chunk && !Mix_Playing(static_cast<int>(channel)))
+        {
+            voices[channel] = Voice{};
+        }
+    }
+
+    // high priority sounds get channels first so a low priority one can't take the last free channel
+    std::stable_sort(pending.begin(), pending.end(), [this](const Request &a, const Request &b)
+                     { return get_limit(a.chunk).priority > get_limit(b.chunk).priority; });
+
+    for (const Request &request : pending)
+    {
+        SoundLimit limit = get_limit(request.chunk);
+        int playing = 0;
+        for (const Voice &voice : voices)
+        {
+            if (voice.chunk == request.chunk)
+            {
+                playing++;
+            }
+        }
+        if (playing >= limit.maxVoices)
+        {
+            limitedCount++;
+            continue;
+        }
+
+        int channel = find_channel(limit.priority);
+        if (channel < 0)
+        {
+            droppedCount++;
+            continue;
+        }
+        if (voices[channel].chunk)
+        {
+            Mix_HaltChannel(channel);
+            stolenCount++;
+        }
+
+        Mix_Volume(channel, request.volume * masterVolume / MIX_MAX_VOLUME);
+        // set before playing so the first samples are already panned, 0 0 removes the position of a reused channel
+        Mix_SetPosition(channel, request.positional ? request.angle : 0, request.positional ? request.distance : 0);
+        if (Mix_PlayChannel(channel, request.chunk, 0) == -1)
+        {
+            std::cerr << "Error: Failed to play sound: " << Mix_GetError() << std::endl;
+            voices[channel] = Voice{};
+            droppedCount++;
+            continue;
+        }
+        voices[channel] = {request.chunk, limit.priority, request.volume, request.distance, ++startedCount};
+        playedCount++;
+    }
+    pending.clear();
+}
+
+void VoiceManager::clear()
+{
+    for (size_t channel = 0; channel < voices.size(); channel++)
+    {
+        if (voices[channel].chunk)
+        {
+            Mix_HaltChannel(static_cast<int>(channel));
+        }
+        voices[channel] = Voice{};
+    }
+    pending.clear();
+    limits.clear();
+}
+
+unsigned long long VoiceManager::get_requested_count() const
+{
+    return requestedCount;
+}
+
+unsigned long long VoiceManager::get_played_count() const
+{
+    return playedCount;
+}
+
+unsigned long long VoiceManager::get_coalesced_count() const
+{
+    return coalescedCount;
+}
+
+unsigned long long VoiceManager::get_culled_count() const
+{
+    return culledCount;
+}
+
+unsigned long long VoiceManager::get_limited_count() const
+{
+    return limitedCount;
+}
+
+unsigned long long VoiceManager::get_stolen_count() const
+{
+    return stolenCount;
+}
+
+unsigned long long VoiceManager::get_dropped_count() const
+{
+    return droppedCount;
+}
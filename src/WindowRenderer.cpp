@@ -0,0 +1,167 @@
+/*
+    Author: Sumeet Singh
+    Dated: 19/10/2026
+    Minimum C++ Standard: C++17
+    Purpose: Class Definition file
+    License: MIT License
+*/
+
+#include <iostream>
+#include "../headers/WindowRenderer.hpp"
+
+WindowRenderer::WindowRenderer()
+{
+    std::cout << "Constructed: WindowRenderer" << std::endl;
+}
+
+WindowRenderer::~WindowRenderer()
+{
+    destroy();
+    std::cout << "Deconstructed: WindowRenderer" << std::endl;
+}
+
+bool WindowRenderer::create(SDL_Window *window, Uint32 flags)
+{
+    destroy();
+    sdlRenderer = SDL_CreateRenderer(window, -1, flags);
+    if (sdlRenderer == nullptr)
+    {
+        std::cerr << "Error: Failed to create renderer: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    reset_statistics();
+    return true;
+}
+
+void WindowRenderer::destroy()
+{
+    if (sdlRenderer)
+    {
+        SDL_DestroyRenderer(sdlRenderer);
+        sdlRenderer = nullptr;
+        next_generation();
+    }
+}
+
+bool WindowRenderer::supports_targets()
+{
+    return sdlRenderer && SDL_RenderTargetSupported(sdlRenderer);
+}
+
+int WindowRenderer::draw_clear()
+{
+    return SDL_RenderClear(sdlRenderer);
+}
+
+int WindowRenderer::draw_fill_rects(const SDL_Rect *rects, int count)
+{
+    return SDL_RenderFillRects(sdlRenderer, rects, count);
+}
+
+int WindowRenderer::draw_outline_rect(const SDL_Rect *rect)
+{
+    return SDL_RenderDrawRect(sdlRenderer, rect);
+}
+
+int WindowRenderer::draw_line_segment(int x1, int y1, int x2, int y2)
+{
+    return SDL_RenderDrawLine(sdlRenderer, x1, y1, x2, y2);
+}
+
+int WindowRenderer::draw_copy(SDL_Texture *texture, const SDL_Rect *src, const SDL_Rect *dst)
+{
+    return SDL_RenderCopy(sdlRenderer, texture, src, dst);
+}
+
+int WindowRenderer::draw_geometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices, int indexCount)
+{
+    return SDL_RenderGeometry(sdlRenderer, texture, vertices, vertexCount, indices, indexCount);
+}
+
+void WindowRenderer::present_frame()
+{
+    SDL_RenderPresent(sdlRenderer);
+}
+
+int WindowRenderer::set_draw_color(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    return SDL_SetRenderDrawColor(sdlRenderer, r, g, b, a);
+}
+
+int WindowRenderer::get_draw_color(Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a)
+{
+    return SDL_GetRenderDrawColor(sdlRenderer, r, g, b, a);
+}
+
+int WindowRenderer::set_draw_blend_mode(SDL_BlendMode blendMode)
+{
+    return SDL_SetRenderDrawBlendMode(sdlRenderer, blendMode);
+}
+
+int WindowRenderer::get_draw_blend_mode(SDL_BlendMode *blendMode)
+{
+    return SDL_GetRenderDrawBlendMode(sdlRenderer, blendMode);
+}
+
+int WindowRenderer::set_target(SDL_Texture *texture)
+{
+    return SDL_SetRenderTarget(sdlRenderer, texture);
+}
+
+SDL_Texture *WindowRenderer::get_target()
+{
+    return SDL_GetRenderTarget(sdlRenderer);
+}
+
+int WindowRenderer::set_viewport(const SDL_Rect *rect)
+{
+    return SDL_RenderSetViewport(sdlRenderer, rect);
+}
+
+void WindowRenderer::get_viewport(SDL_Rect *rect)
+{
+    SDL_RenderGetViewport(sdlRenderer, rect);
+}
+
+int WindowRenderer::set_clip_rect(const SDL_Rect *rect)
+{
+    return SDL_RenderSetClipRect(sdlRenderer, rect);
+}
+
+int WindowRenderer::get_output_size(int *w, int *h)
+{
+    return SDL_GetRendererOutputSize(sdlRenderer, w, h);
+}
+
+SDL_Texture *WindowRenderer::create_texture(Uint32 format, int access, int w, int h)
+{
+    return SDL_CreateTexture(sdlRenderer, format, access, w, h);
+}
+
+SDL_Texture *WindowRenderer::create_texture_from_surface(SDL_Surface *surface)
+{
+    return SDL_CreateTextureFromSurface(sdlRenderer, surface);
+}
+
+int WindowRenderer::update_texture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch)
+{
+    return SDL_UpdateTexture(texture, rect, pixels, pitch);
+}
+
+int WindowRenderer::update_yuv_texture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *yPlane, int yPitch, const Uint8 *uPlane, int uPitch, const Uint8 *vPlane, int vPitch)
+{
+    return SDL_UpdateYUVTexture(texture, rect, yPlane, yPitch, uPlane, uPitch, vPlane, vPitch);
+}
+
+int WindowRenderer::set_texture_blend_mode(SDL_Texture *texture, SDL_BlendMode blendMode)
+{
+    return SDL_SetTextureBlendMode(texture, blendMode);
+}
+
+void WindowRenderer::destroy_texture(SDL_Texture *texture)
+{
+    if (texture)
+    {
+        SDL_DestroyTexture(texture);
+    }
+}
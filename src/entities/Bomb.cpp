@@ -24,14 +24,10 @@ void Bomb::handle_player_collision(std::vector<Entity *> &entities)
             SDL_Rect playerRect = e->get_rect();
             if (SDL_HasIntersection(&thisRect, &playerRect))
             {
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
                 e->set_health(e->get_health() - 1);
                 // Play fire particles animation
-                int random = (rand() % 50) + 5;
-                for (int i = 0; i < random; ++i)
-                {
-                    particles.push_back(ParticleGenerator(thisRect.x, thisRect.y, "fire"));
-                }
+                particles.emit(ParticlePreset::FIRE, thisRect.x, thisRect.y, (rand() % 50) + 5);
             }
         }
     }
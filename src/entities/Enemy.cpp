@@ -22,7 +22,7 @@ void Enemy::handle_player_collision(std::vector<Entity *> &entities)
             SDL_Rect playerRect = e->get_rect();
             if (SDL_HasIntersection(&thisRect, &playerRect))
             {
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
                 // Play some animation possible swining sword to attack player and making noise
             }
         }
@@ -20,7 +20,7 @@ void Item::handle_player_collision(std::vector<Entity *> &entities)
             SDL_Rect thisRect = this->get_rect();
             if (SDL_HasIntersection(&thisRect, &playerRect))
             {
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
             }
         }
     }
@@ -23,7 +23,7 @@ void Obstacle::handle_player_collision(std::vector<Entity *> &entities)
             if (SDL_HasIntersection(&playerRect, &obstacleRect))
             {
                 std::cout << "Player collided with an obstacle: " << e->get_entity_name() << std::endl;
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
 
                 // Determine the direction of collision
                 int dx = playerRect.x + playerRect.w / 2 - obstacleRect.x - obstacleRect.w / 2;
@@ -118,7 +118,7 @@ void Obstacle::handle_item_collision(std::vector<Entity *> &entities)
             if (SDL_HasIntersection(&itemRect, &obstacleRect))
             {
                 std::cout << "Item collided with an obstacle: " << e->get_entity_name() << std::endl;
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
 
                 // Determine the direction of collision
                 int dx = itemRect.x + itemRect.w / 2 - obstacleRect.x - obstacleRect.w / 2;
@@ -176,7 +176,7 @@ void Obstacle::handle_obstacle_collision(std::vector<Entity *> &entities)
             if (SDL_HasIntersection(&obstacleRect1, &obstacleRect2))
             {
                 std::cout << "Obstacle collided with another obstacle: " << e->get_entity_name() << std::endl;
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
 
                 // Determine the direction of collision
                 int dx = obstacleRect1.x + obstacleRect1.w / 2 - obstacleRect2.x - obstacleRect2.w / 2;
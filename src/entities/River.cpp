@@ -25,13 +25,9 @@ void River::handle_player_collision(std::vector<Entity *> &entities)
             if (SDL_HasIntersection(&playerRect, &thisRect))
             {
                 std::cout << "Player collided with an obstacle: " << e->get_entity_name() << std::endl;
-                Mix_PlayChannel(-1, collisionSound, 0);
+                play_collision_sound();
                 // Play water particles animation
-                int random = (rand() % 50) + 5;
-                for (int i = 0; i < random; ++i)
-                {
-                    particles.push_back(ParticleGenerator(thisRect.x, thisRect.y, "water"));
-                }
+                particles.emit(ParticlePreset::WATER, thisRect.x, thisRect.y, (rand() % 50) + 5);
 
                 // Determine the direction of collision
                 int dx = playerRect.x + playerRect.w / 2 - thisRect.x - thisRect.w / 2;
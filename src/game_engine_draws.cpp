@@ -30,12 +30,15 @@
 
 // FORWARD DECLARATIONS
 void render_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
+void render_dynamic_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
 void draw_file_contents_to_screen(const std::string &fileToOutput);
+void draw_minimap();
 
 void draw_timer()
 {
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::HUD);
     SDL_Rect timerRect = {static_cast<int>(SCREEN_WIDTH * 0.05), static_cast<int>(SCREEN_HEIGHT * 0.03), (SCREEN_WIDTH / 5), (SCREEN_HEIGHT / 8)};
-    SDL_RenderCopy(renderer, timerTexture, nullptr, &timerRect);
+    renderer->copy(timerTexture, nullptr, &timerRect);
 
     int minutes = countdownSeconds / 60;
     int seconds = countdownSeconds % 60;
@@ -43,7 +46,7 @@ void draw_timer()
     // If minutes or seconds < 10, it will add an 0 e.g. 120 seconds = 2. As 2 < 10, final output: 02:00
     std::string timerText = (minutes < 10 ? "0" : "") + std::to_string(minutes) + ":" + (seconds < 10 ? "0" : "") + std::to_string(seconds);
 
-    render_text(timerText, timerRect.x + 130, timerRect.y + 30, 0, 0, 0, 255, defaultFont);
+    render_dynamic_text(timerText, timerRect.x + 130, timerRect.y + 30, 0, 0, 0, 255, defaultFont);
 }
 void draw_scores(const std::vector<Score> &scores)
 {
@@ -53,14 +56,14 @@ void draw_scores(const std::vector<Score> &scores)
     render_text("TIME", (SCREEN_WIDTH * 0.7), (SCREEN_HEIGHT * 0.2), 0, 0, 0, 255, defaultFont);
 
     // Draw grid lines
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Black
+    renderer->set_draw_color(0, 0, 0, 255); // Black
     for (int i = 0; i < 11; i++)                    // draw 11 horizontal lines
     {
-        SDL_RenderDrawLine(renderer, 0, (SCREEN_HEIGHT * 0.25) + i * (SCREEN_HEIGHT * 0.1), SCREEN_WIDTH, (SCREEN_HEIGHT * 0.25) + i * (SCREEN_HEIGHT * 0.1));
+        renderer->draw_line(0, (SCREEN_HEIGHT * 0.25) + i * (SCREEN_HEIGHT * 0.1), SCREEN_WIDTH, (SCREEN_HEIGHT * 0.25) + i * (SCREEN_HEIGHT * 0.1));
     }
     for (int i = 1; i < 3; ++i) // Draw 2 vertical lines
     {
-        SDL_RenderDrawLine(renderer, i * (SCREEN_WIDTH * 0.3), (SCREEN_HEIGHT * 0.2), i * (SCREEN_WIDTH * 0.3), SCREEN_HEIGHT);
+        renderer->draw_line(i * (SCREEN_WIDTH * 0.3), (SCREEN_HEIGHT * 0.2), i * (SCREEN_WIDTH * 0.3), SCREEN_HEIGHT);
     }
 
     // std::sort(scores.begin(), scores.end(), compare_scores);
@@ -79,51 +82,66 @@ void draw_scores(const std::vector<Score> &scores)
         }
         if (i != 10) // Render only 10 scores max
         {
-            render_text(s.name, (SCREEN_WIDTH * 0.1), (SCREEN_HEIGHT * (0.3 + y)), 0, 0, 0, 255, defaultFont);
-            render_text(std::to_string(s.score), (SCREEN_WIDTH * 0.4), (SCREEN_HEIGHT * (0.3 + y)), 0, 0, 0, 255, defaultFont);
-            render_text(s.datetime, (SCREEN_WIDTH * 0.7), (SCREEN_HEIGHT * (0.3 + y)), 0, 0, 0, 255, defaultFont);
+            render_dynamic_text(s.name, (SCREEN_WIDTH * 0.1), (SCREEN_HEIGHT * (0.3 + y)), 0, 0, 0, 255, defaultFont);
+            render_dynamic_text(std::to_string(s.score), (SCREEN_WIDTH * 0.4), (SCREEN_HEIGHT * (0.3 + y)), 0, 0, 0, 255, defaultFont);
+            render_dynamic_text(s.datetime, (SCREEN_WIDTH * 0.7), (SCREEN_HEIGHT * (0.3 + y)), 0, 0, 0, 255, defaultFont);
         }
     }
 }
 void draw_HUD()
 {
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::HUD);
     for (Entity *e : entities)
     {
         if (Player *player = dynamic_cast<Player *>(e))
         {
             if (player->get_player_id() == clientPlayerID)
             {
-                render_text("Score: " + std::to_string(player->get_score()), (SCREEN_WIDTH * 0.4), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
-                render_text("Health: " + std::to_string(player->get_health()), (SCREEN_WIDTH * 0.6), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
+                render_dynamic_text("Score: " + std::to_string(player->get_score()), (SCREEN_WIDTH * 0.4), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
+                render_dynamic_text("Health: " + std::to_string(player->get_health()), (SCREEN_WIDTH * 0.6), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
             }
         }
     }
 }
-void draw_entities()
+bool is_entity_visible(const SDL_Rect &entityRect, const SDL_Rect &viewRect)
 {
-    for (Entity *e : entities)
+    return SDL_HasIntersection(&entityRect, &viewRect) == SDL_TRUE;
+}
+void draw_entities(const RenderSnapshots::Snapshot &snapshot, const RenderSnapshots::View &view)
+{
+    // sprites were culled and animated by update_render_snapshot(), only the snapshot is read here
+    // they're queued by zPos and texture, renderQueue.submit() in draw_scene_gameplay() draws them
+    for (size_t i = view.firstSprite; i < view.firstSprite + view.spriteCount; i++)
     {
-        // update entity position based on player camera position
-        SDL_Point cameraDisplacement;
-        if (Player *player = dynamic_cast<Player *>(e))
-        {
-            if (player->get_player_id() == clientPlayerID)
-            {
-                cameraDisplacement.x = ((player->get_rect().x + (player->get_rect().w / 2)) - (SCREEN_WIDTH / 2)) * 0.1;
-                cameraDisplacement.y = ((player->get_rect().y + (player->get_rect().h / 2)) - (SCREEN_HEIGHT / 2)) * 0.1;
-                // finally draw player then exit out of function with continue
-                e->update_animation();
-                e->set_animation_texture();
-                e->render_texture(cameraRect.x, cameraRect.y);
-            }
-            continue;
-        }
-        // draw entities with displacement
-        e->update_animation();
-        e->set_animation_texture();
-        e->render_texture(cameraDisplacement.x, cameraDisplacement.y);
+        const RenderSnapshots::Sprite &sprite = snapshot.sprites[i];
+        renderQueue.copy(RenderQueue::LAYER_ENTITIES, sprite.zPos, sprite.texture, sprite.rect);
     }
 }
+bool is_static_layer_entity(Entity *e)
+{
+    // obstacles with a single texture never change how they look, they only move if pushed apart on spawn
+    return dynamic_cast<Obstacle *>(e) != nullptr && e->get_animation_frame_count() <= 1;
+}
+void draw_static_layer(const RenderSnapshots::View &view)
+{
+    // background stretched over the window like every other scene, a split-screen view shows its part of it
+    SDL_Rect backgroundRect = {-view.screen.x, -view.screen.y, SCREEN_WIDTH, SCREEN_HEIGHT};
+    renderer->copy(background1Texture, nullptr, &backgroundRect);
+
+    // staticLayer.update() runs in update_render_snapshot(), without render target support obstacles are
+    // drawn with the rest of the entities
+    staticLayer.draw(renderer, view.camera, GAME_WORLD_WIDTH, GAME_WORLD_HEIGHT);
+}
+void draw_debug_overlay()
+{
+    render_dynamic_text("Entities: " + std::to_string(entitiesDrawnCount) + "/" + std::to_string(entitiesTotalCount), (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.15), 0, 0, 0, 255, defaultFont);
+    render_dynamic_text("Text cache: " + std::to_string(textCache.get_last_frame_hits()) + " hits " + std::to_string(textCache.get_last_frame_misses()) + " misses", (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.2), 0, 0, 0, 255, defaultFont);
+    render_dynamic_text("Static chunks: " + std::to_string(staticLayer.get_chunks_drawn()), (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.25), 0, 0, 0, 255, defaultFont);
+    render_dynamic_text("Particles: " + std::to_string(particles.get_count()) + " live " + std::to_string(particleBudget.get_dropped_count()) + " dropped", (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.35), 0, 0, 0, 255, defaultFont);
+    render_dynamic_text("Render queue: " + std::to_string(renderQueue.get_last_command_count()) + " draws " + std::to_string(renderQueue.get_last_state_changes()) + " switches", (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.3), 0, 0, 0, 255, defaultFont);
+    render_dynamic_text("Sounds: " + std::to_string(voiceManager.get_played_count()) + "/" + std::to_string(voiceManager.get_requested_count()) + " played " + std::to_string(voiceManager.get_stolen_count()) + " stolen " + std::to_string(voiceManager.get_culled_count()) + " culled", (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.4), 0, 0, 0, 255, defaultFont);
+    render_dynamic_text("Audio: " + std::to_string(audioDevice.get_buffer_frames()) + " frames " + std::to_string(static_cast<int>(audioDevice.get_latency() + 0.5f)) + "ms " + std::to_string(audioDevice.get_underrun_count()) + " underruns", (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.45), 0, 0, 0, 255, defaultFont);
+}
 
 void draw_scene_1()
 {
@@ -189,10 +207,10 @@ void draw_scene_5()
     render_text("HELP", (SCREEN_WIDTH * 0.35), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
 
     // Draw a box background to read easier
-    SDL_SetRenderDrawColor(renderer, 220, 193, 167, 255); // RGB: Sepia
+    renderer->set_draw_color(220, 193, 167, 255); // RGB: Sepia
     SDL_Rect greyboxRect = {static_cast<int>(SCREEN_WIDTH * 0.05), static_cast<int>(SCREEN_HEIGHT * 0.01),
                             static_cast<int>(SCREEN_WIDTH * 0.85), SCREEN_HEIGHT};
-    SDL_RenderFillRect(renderer, &greyboxRect);
+    renderer->fill_rect(&greyboxRect);
 
     draw_file_contents_to_screen(readmeFileName);
 
@@ -329,10 +347,10 @@ void draw_scene_10()
     render_text("DISPLAY POLICIES", (SCREEN_WIDTH * 0.35), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
 
     // Draw a box background to read easier
-    SDL_SetRenderDrawColor(renderer, 220, 193, 167, 255); // RGB: Sepia
+    renderer->set_draw_color(220, 193, 167, 255); // RGB: Sepia
     SDL_Rect greyboxRect = {static_cast<int>(SCREEN_WIDTH * 0.05), static_cast<int>(SCREEN_HEIGHT * 0.01),
                             static_cast<int>(SCREEN_WIDTH * 0.85), SCREEN_HEIGHT};
-    SDL_RenderFillRect(renderer, &greyboxRect);
+    renderer->fill_rect(&greyboxRect);
 
     if (!scene10acceptPrivacyPolicyButton.get_clicked())
     {
@@ -384,10 +402,10 @@ void draw_scene_14()
     render_text("CREDITS", (SCREEN_WIDTH * 0.45), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, font48);
 
     // Draw a box background to read easier
-    SDL_SetRenderDrawColor(renderer, 220, 193, 167, 255); // RGB: Sepia
+    renderer->set_draw_color(220, 193, 167, 255); // RGB: Sepia
     SDL_Rect greyboxRect = {static_cast<int>(SCREEN_WIDTH * 0.05), static_cast<int>(SCREEN_HEIGHT * 0.01),
                             static_cast<int>(SCREEN_WIDTH * 0.85), SCREEN_HEIGHT};
-    SDL_RenderFillRect(renderer, &greyboxRect);
+    renderer->fill_rect(&greyboxRect);
 
     draw_file_contents_to_screen(creditsFileName);
 
@@ -563,13 +581,188 @@ void draw_scene_31()
         b->render_button_rect();
     }
 }
+void draw_menu_scene(int scene)
+{
+    switch (scene)
+    {
+    case 1:
+        draw_scene_1();
+        break;
+    case 2:
+        draw_scene_2();
+        break;
+    case 3:
+        draw_scene_3();
+        break;
+    case 4:
+        draw_scene_4();
+        break;
+    case 5:
+        draw_scene_5();
+        break;
+    case 6:
+        draw_scene_6();
+        break;
+    case 7:
+        draw_scene_7();
+        break;
+    case 8:
+        draw_scene_8();
+        break;
+    case 9:
+        draw_scene_9();
+        break;
+    case 10:
+        draw_scene_10();
+        break;
+    case 11:
+        draw_scene_11();
+        break;
+    case 12:
+        draw_scene_12();
+        break;
+    case 13:
+        draw_scene_13();
+        break;
+    case 14:
+        draw_scene_14();
+        break;
+    case 15:
+        draw_scene_15();
+        break;
+    case 16:
+        draw_scene_16();
+        break;
+    case 17:
+        draw_scene_17();
+        break;
+    case 18:
+        draw_scene_18();
+        break;
+    case 19:
+        draw_scene_19();
+        break;
+    case 20:
+        draw_scene_20();
+        break;
+    case 21:
+        draw_scene_21();
+        break;
+    case 22:
+        draw_scene_22();
+        break;
+    case 23:
+        draw_scene_23();
+        break;
+    case 24:
+        draw_scene_24();
+        break;
+    case 25:
+        draw_scene_25();
+        break;
+    case 26:
+        draw_scene_26();
+        break;
+    case 27:
+        draw_scene_27();
+        break;
+    case 28:
+        draw_scene_28();
+        break;
+    case 29:
+        draw_scene_29();
+        break;
+    case 30:
+        draw_scene_30();
+        break;
+    case 31:
+        draw_scene_31();
+        break;
+    default:
+        break;
+    }
+}
+bool is_menu_scene_cacheable(int scene)
+{
+    // scene 7 and 9 show results from update/webserver threads that don't come through handle()
+    return scene >= 1 && scene <= 31 && scene != 7 && scene != 9;
+}
+size_t menu_scene_signature(int scene)
+{
+    size_t signature{};
+    MenuCompositor::hash_combine(signature, scene);
+    MenuCompositor::hash_combine(signature, SCREEN_WIDTH);
+    MenuCompositor::hash_combine(signature, SCREEN_HEIGHT);
+    MenuCompositor::hash_combine(signature, language);
+    MenuCompositor::hash_combine(signature, static_cast<const void *>(defaultFont));
+    MenuCompositor::hash_combine(signature, menuGeneration);
+
+    // what the scene draws outside its buttons, buttons are checked by menuCompositor itself
+    switch (scene)
+    {
+    case 2:
+        MenuCompositor::hash_combine(signature, soundVolume);
+        MenuCompositor::hash_combine(signature, musicVolume);
+        MenuCompositor::hash_combine(signature, scrollSpeed);
+        MenuCompositor::hash_combine(signature, scene2resolutionsDropdownButton.get_clicked());
+        break;
+    case 4:
+        MenuCompositor::hash_combine(signature, scores.size());
+        MenuCompositor::hash_combine(signature, scene4inputPlayerNameButton.get_clicked());
+        break;
+    case 5:
+    case 14:
+        MenuCompositor::hash_combine(signature, scrollYpos);
+        break;
+    case 10:
+        MenuCompositor::hash_combine(signature, scrollYpos);
+        MenuCompositor::hash_combine(signature, scene10acceptPrivacyPolicyButton.get_clicked());
+        break;
+    case 15:
+        MenuCompositor::hash_combine(signature, scene15FileDropdownButton.get_clicked());
+        break;
+    default:
+        break;
+    }
+    return signature;
+}
 void draw_scene_gameplay()
 {
-    draw_entities();
+    const RenderSnapshots::Snapshot &snapshot = renderSnapshots.acquire();
+    entitiesTotalCount = snapshot.entitiesTotal;
+    entitiesDrawnCount = snapshot.entitiesDrawn;
+
+    // one view unless local players are playing split-screen, each is clipped to its part of the window
+    bool splitScreen = snapshot.views.size() > 1;
+    for (const RenderSnapshots::View &view : snapshot.views)
+    {
+        if (splitScreen)
+        {
+            renderer->set_viewport(&view.screen);
+        }
+        draw_static_layer(view);
+        draw_entities(snapshot, view);
+        renderQueue.submit(renderer); // sorted to minimise texture switches
+        particles.render(renderer, view.camera); // moved in update_scene_gameplay(), drawn in one batch per view
+    }
+    if (splitScreen)
+    {
+        renderer->set_viewport(nullptr);
+    }
+    if (snapshot.views.empty())
+    {
+        renderer->copy(background1Texture, nullptr, nullptr); // nothing published yet
+    }
+
+    // HUD, timer and minimap are single-view, drawn once over the whole window for the client player
     draw_HUD();
     draw_timer();
-    ParticleGenerator::render_particles(particles, renderer);
-    ParticleGenerator::clear_particles(particles, SCREEN_HEIGHT);
+    draw_minimap();
+
+    if (displayFPS) // debug overlay shares the settings menu FPS toggle
+    {
+        draw_debug_overlay();
+    }
 
     if (displayOnScreenKeys) // if you want on screen keys show all the buttons e.g. UP, DOWN, A, MENU
     {
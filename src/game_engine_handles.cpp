@@ -75,6 +75,7 @@
 void setup_reset_game();
 void toggle_countdown();
 void recreate_renderer(); /** for user vsync toggle button */
+void invalidate_button_label_textures(std::vector<BaseButton *> &allButtons); /** for language toggle button */
 
 void handle_controller_added(SDL_Event event)
 {
@@ -237,11 +238,13 @@ void handle_mouse_scene_2(const int &mouseX, const int &mouseY, bool gamePaused)
         {
             language = "日本語";
             std::cout << "Language now set to: " << language << std::endl;
+            invalidate_button_label_textures(allButtons);
         }
         else
         {
             language = "English";
             std::cout << "Language now set to: " << language << std::endl;
+            invalidate_button_label_textures(allButtons);
         }
     }
     else if (scene2changeKeymappingButton.is_clicked(mousePosition))
@@ -1093,11 +1096,13 @@ void handle_keyboard_scene_2(const SDL_Event &event, bool gamePaused)
                 {
                     language = "日本語";
                     std::cout << "Language now set to: " << language << std::endl;
+                    invalidate_button_label_textures(allButtons);
                 }
                 else
                 {
                     language = "English";
                     std::cout << "Language now set to: " << language << std::endl;
+                    invalidate_button_label_textures(allButtons);
                 }
             }
             else if (scene2changeKeymappingButton.is_selected())
@@ -2938,11 +2943,13 @@ void handle_gamepad_scene_2(const int &button, bool gamePaused)
                 {
                     language = "日本語";
                     std::cout << "Language now set to: " << language << std::endl;
+                    invalidate_button_label_textures(allButtons);
                 }
                 else
                 {
                     language = "English";
                     std::cout << "Language now set to: " << language << std::endl;
+                    invalidate_button_label_textures(allButtons);
                 }
             }
             else if (scene2changeKeymappingButton.is_selected())
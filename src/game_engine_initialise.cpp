@@ -29,6 +29,7 @@
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_mixer.h>
+#include <cstdlib> // for std::getenv
 #include "../headers/game_engine_draws.hpp"
 #include "../headers/game_engine_handles.hpp"
 #include "../headers/game_engine_updates.hpp"
@@ -36,8 +37,9 @@
 // FORWARD DECLARATIONS
 void handle(bool gamePaused);
 void update(int &soundVolume, int &musicVolume, int &scene, bool gamePaused);
-void draw(SDL_Renderer *&renderer, int &scene, SDL_Texture *&background1Texture, float fps, bool gamePaused);
+void draw(RenderBackend *renderer, int &scene, SDL_Texture *&background1Texture, float fps, bool gamePaused);
 void render_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
+void render_dynamic_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
 
 void add_buttons_to_dropdown_buttons() {
     scene2resolutionsDropdownButton.add_button_to_dropdown_list(scene2resolutionsDropdown1366x768Button);
@@ -229,7 +231,7 @@ void load_buttons_to_all_buttons_vector(std::vector<BaseButton *> &allButtons)
     allButtons.insert(allButtons.end(), scene31buttons.begin(), scene31buttons.end());
     allButtons.insert(allButtons.end(), sceneGameplaybuttons.begin(), sceneGameplaybuttons.end());
 }
-void initialise_button_renderer(SDL_Renderer *renderer)
+void initialise_button_renderer(RenderBackend *renderer)
 {
     for (BaseButton *button : allButtons)
     {
@@ -240,10 +242,10 @@ void initialise_button_textures(std::vector<BaseButton *> &allButtons)
 {
     for (BaseButton *button : allButtons)
     {
-        button->set_button_texture();
+        button->set_button_texture(textureLoader);
         if (SliderButton *x = dynamic_cast<SliderButton *>(button))
         {
-            x->set_slider_dot_texture();
+            x->set_slider_dot_texture(textureLoader);
         }
     }
 }
@@ -254,19 +256,45 @@ void initialise_button_fonts(std::vector<BaseButton *> &allButtons)
         button->set_font_size(defaultFont, 24);
     }
 }
+void invalidate_button_label_textures(std::vector<BaseButton *> &allButtons)
+{
+    for (BaseButton *button : allButtons)
+    {
+        button->invalidate_label_texture();
+    }
+}
 
 SDL_Texture *load_texture(const std::string &textureFilePath)
 {
-    SDL_Texture *texture = IMG_LoadTexture(renderer, textureFilePath.c_str());
+    SDL_Texture *texture = renderer->load_texture(textureFilePath);
     if (!texture)
     {
         logger.log_critical("Error: Failed to load texture: " + textureFilePath + ": " + std::string(IMG_GetError()));
     }
     return texture;
 }
+void load_texture_async(const std::string &textureFilePath, SDL_Texture *&texture)
+{
+    texture = textureLoader.load(renderer, textureFilePath, [&texture](SDL_Texture *loaded)
+                                 { texture = loaded; });
+}
+void upload_loaded_textures()
+{
+    if (textureLoader.upload(renderer) == 0)
+    {
+        return;
+    }
+    // placeholders were replaced, cached drawings that used them are out of date
+    menuGeneration++;
+    staticLayer.invalidate();
+    for (Entity *e : entities)
+    {
+        e->update_animation(animationClips);
+    }
+}
 Mix_Chunk *load_sound(const std::string sfxFilePath)
 {
-    Mix_Chunk *sound = Mix_LoadWAV(sfxFilePath.c_str());
+    Mix_Chunk *sound = soundBank.acquire(sfxFilePath); // shared with entities using the same file
     if (sound == nullptr)
     {
         logger.log_critical("Error: Failed to load sound: " + sfxFilePath + ": " + Mix_GetError());
@@ -316,15 +344,15 @@ void load_controllers()
 void load_textures()
 {
     // backgrounds
-    background1Texture = load_texture("assets/graphics/backgrounds/Background 01/PNG/1920x1080.png");
+    load_texture_async("assets/graphics/backgrounds/Background 01/PNG/1920x1080.png", background1Texture);
 
     // HUD textures
-    heartTexture = load_texture("assets/graphics/HUD/heart.png");
-    hearts2Texture = load_texture("assets/graphics/HUD/2hearts.png");
-    hearts3Texture = load_texture("assets/graphics/HUD/3hearts.png");
-    hearts4Texture = load_texture("assets/graphics/HUD/4hearts.png");
-    hearts5Texture = load_texture("assets/graphics/HUD/5hearts.png");
-    timerTexture = load_texture("assets/graphics/HUD/timer.png");
+    load_texture_async("assets/graphics/HUD/heart.png", heartTexture);
+    load_texture_async("assets/graphics/HUD/2hearts.png", hearts2Texture);
+    load_texture_async("assets/graphics/HUD/3hearts.png", hearts3Texture);
+    load_texture_async("assets/graphics/HUD/4hearts.png", hearts4Texture);
+    load_texture_async("assets/graphics/HUD/5hearts.png", hearts5Texture);
+    load_texture_async("assets/graphics/HUD/timer.png", timerTexture);
 }
 void load_sounds()
 {
@@ -344,22 +372,18 @@ void load_sounds()
     lockSound = load_sound("assets/sounds/sound-effects/wavs/Lock the door - Pixabay.wav");
     explosionSound = load_sound("assets/sounds/sound-effects/wavs/Medium Explosion - Pixabay.wav");
     clothesSound = load_sound("assets/sounds/sound-effects/wavs/clothes drop 2 - Pixabay.wav");
+
+    // game results must be heard even when collisions fill every channel
+    voiceManager.set_sound_limit(winGameSound, 1, SoundPriority::HIGH);
+    voiceManager.set_sound_limit(loseGameSound, 1, SoundPriority::HIGH);
+    // bombs share this chunk through soundBank, a chain of explosions plays at most 4 at once
+    voiceManager.set_sound_limit(explosionSound, 4, SoundPriority::NORMAL);
 }
 void load_music(const std::string &songTitle)
 {
     if (musicPlaying)
     {
-        music = Mix_LoadMUS(songTitle.c_str());
-        if (!music)
-        {
-            logger.log_critical("Error: Failed to load music: " + std::string(Mix_GetError()));
-            music = nullptr;
-        }
-        else
-        {
-            Mix_PlayMusic(music, -1); // Set loops to -1 for infinite looping
-            logger.log_non_critical("Music playing is: " + songTitle);
-        }
+        musicManager.play(songTitle); // loads on the music thread and fades in, musicManager logs it once it starts
     }
 }
 void load_fonts()
@@ -487,29 +511,40 @@ void set_font(const std::string &language)
 }
 void render_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font)
 {
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::TEXT);
     SDL_Color textColor = {redText, greenText, blueText, alphaText};
-    SDL_Surface *textSurface = TTF_RenderUTF8_Blended(font, text.c_str(), textColor);
+    int textWidth{}, textHeight{};
 
-    if (textSurface)
+    // texture is owned by textCache so static labels are only rasterised once
+    SDL_Texture *textTexture = textCache.get_texture(renderer, text, font, textColor, textWidth, textHeight);
+    if (textTexture)
     {
-        int textWidth, textHeight;
-        // Calculate textWidth and textHeight using TTF_SizeText
-        TTF_SizeText(font, text.c_str(), &textWidth, &textHeight);
-
-        SDL_Texture *textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-        SDL_FreeSurface(textSurface);
+        SDL_Rect textRect = {x, y, textWidth, textHeight};
+        renderer->copy(textTexture, nullptr, &textRect);
+    }
+}
+void render_dynamic_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font)
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::TEXT);
+    SDL_Color textColor = {redText, greenText, blueText, alphaText};
 
-        if (textTexture)
-        {
-            SDL_Rect textRect = {x, y, textWidth, textHeight};
-            SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-        }
-        SDL_DestroyTexture(textTexture);
+    // scripts that need shaping e.g. Arabic aren't supported by the glyph atlas so use the whole string cache
+    if (!glyphAtlas.draw_text(renderer, text, x, y, textColor, font))
+    {
+        render_text(text, x, y, redText, greenText, blueText, alphaText, font);
     }
 }
 void start_SDL()
 {
-    if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
+    // CI boxes without a display run with SDL_VIDEODRIVER=dummy, or tests set headlessMode before start_SDL()
+    // headless runs have no window, audio device or intro video and draws are only recorded by headlessRenderer
+    const char *videoDriver = std::getenv("SDL_VIDEODRIVER");
+    if (videoDriver && std::string(videoDriver) == "dummy")
+    {
+        headlessMode = true;
+    }
+
+    if (SDL_Init(headlessMode ? SDL_INIT_TIMER | SDL_INIT_EVENTS : SDL_INIT_EVERYTHING) != 0)
     {
         logger.log_critical("Error: Failed to initialise SDL" + std::string(SDL_GetError()));
         exit(1);
@@ -519,6 +554,12 @@ void start_SDL()
         logger.log_critical("Success: initialised: SDL2");
     }
 
+    wakeEventType = SDL_RegisterEvents(1);
+    if (wakeEventType == static_cast<Uint32>(-1))
+    {
+        logger.log_critical("Error: Failed to register wake event: " + std::string(SDL_GetError()));
+    }
+
     if (TTF_Init() != 0)
     {
         logger.log_critical("Error: Failed to initialize SDL Font: " + std::string(TTF_GetError()));
@@ -552,28 +593,52 @@ void start_SDL()
         logger.log_critical("Success: initialised: SDL2 Mixer");
     }
 
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 4096) == -1)
+    if (headlessMode)
+    {
+        logger.log_critical("Success: headless, no audio device opened");
+    }
+    else if (!audioDevice.open(audioProfile))
     {
         logger.log_critical("Error: Failed to open audio channel: " + std::string(Mix_GetError()));
     }
     else
     {
-        logger.log_critical("Success: initialised: SDL2 Mixer Audio");
+        logger.log_critical("Success: initialised: SDL2 Mixer Audio, " + std::to_string(audioDevice.get_buffer_frames()) + " frame buffer");
+        voiceManager.open();
+        musicManager.start();
     }
 
-    window = SDL_CreateWindow("BubbleUp", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE | SDL_WINDOW_MAXIMIZED);
-    if (!window)
+    if (headlessMode)
     {
-        logger.log_critical("Error: Failed to create SDL Window: " + std::string(SDL_GetError()));
-        SDL_Quit();
-        exit(1);
+        headlessRenderer.create(SCREEN_WIDTH, SCREEN_HEIGHT); // records draws, no window, GPU or vsync
+        renderer = &headlessRenderer;
     }
     else
     {
-        logger.log_critical("Success: initialised: SDL2 window");
+        window = SDL_CreateWindow("BubbleUp", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE | SDL_WINDOW_MAXIMIZED);
+        if (!window)
+        {
+            logger.log_critical("Error: Failed to create SDL Window: " + std::string(SDL_GetError()));
+            SDL_Quit();
+            exit(1);
+        }
+        else
+        {
+            logger.log_critical("Success: initialised: SDL2 window");
+        }
+        set_particle_frame_budget();
+        // where SDL allows it the renderer is created on and presents from the render thread, events stay on this thread
+        Uint32 rendererFlags = SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC;
+        if (RenderThread::is_supported())
+        {
+            renderThread.set_window_event_callback(wake_event_loop);
+            renderer = renderThread.start(window, rendererFlags) ? &renderThread : nullptr;
+        }
+        else
+        {
+            renderer = windowRenderer.create(window, rendererFlags) ? &windowRenderer : nullptr;
+        }
     }
-
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
     if (!renderer)
     {
         logger.log_critical("Error: Failed to create Renderer: " + std::string(SDL_GetError()));
@@ -584,21 +649,32 @@ void start_SDL()
     {
         logger.log_critical("Success: initialised: SDL2 renderer");
     }
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND); // Set blend mode
+    renderer->set_draw_blend_mode(SDL_BLENDMODE_BLEND); // Set blend mode
+
+    // images are decoded on worker threads while the rest of startup continues
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    textureLoader.start(std::max(1, std::min(4, static_cast<int>(hardwareThreads) - 1)));
+    textureLoader.set_decoded_callback(wake_event_loop);
 
     load_fonts();
     set_font(language);
     load_textures();
-    load_sounds();
+    if (!headlessMode) // Mix_LoadWAV() needs the audio device
+    {
+        load_sounds();
+    }
     add_buttons_to_dropdown_buttons();
     load_buttons_to_scene_vectors();
     load_buttons_to_all_buttons_vector(allButtons);
     initialise_button_renderer(renderer);
     initialise_button_textures(allButtons);
     initialise_button_fonts(allButtons);
-    FFmpegVideoPlayer videoPlayer("assets/videos/sample.mp4", "assets/videos/sample.mp3", window, renderer);
-    videoPlayer.playVideo();
-    load_music("assets/sounds/music/Game Time - moodmode-studio.mp3");
+    if (!headlessMode) // nobody to watch the intro cinematic or hear the music
+    {
+        FFmpegVideoPlayer videoPlayer("assets/videos/sample.mp4", "assets/videos/sample.mp3", window, renderer);
+        videoPlayer.playVideo();
+        load_music("assets/sounds/music/Game Time - moodmode-studio.mp3");
+    }
 }
 void run_SDL()
 {
@@ -607,14 +683,59 @@ void run_SDL()
     // FPS variables
     int startTime, endTime{};
     float fps, frameCount, elapsedTime{};
+    int ticks{};
 
     while (!quitEventLoop)
     {
+        // headless benchmarks and tests stop on their own after headlessTickLimit ticks
+        if (headlessMode && headlessTickLimit > 0 && ticks++ >= headlessTickLimit)
+        {
+            break;
+        }
+
+        // static menus only change on events so sleep until one arrives (or wake_event_loop() is called)
+        // instead of redrawing the same frame as fast as vsync allows, the event stays queued for handle()
+        if (is_menu_scene_cacheable(scene) && !headlessMode)
+        {
+            SDL_WaitEventTimeout(nullptr, idleWaitTimeout);
+        }
+
         startTime = SDL_GetTicks(); // FPS
+        textCache.begin_frame();
+        renderThread.forward_window_events(); // so the renderer sees resizes on its own thread before handle() does
 
         handle(gamePaused);
+        upload_loaded_textures(); // before update() so the render snapshot it publishes sees the uploaded textures
         update(soundVolume, musicVolume, scene, gamePaused);
         draw(renderer, scene, background1Texture, fps, gamePaused);
+        particleBudget.end_frame(static_cast<float>(static_cast<int>(SDL_GetTicks()) - startTime)); // thins particle spawns while frames are slow
+        if (audioDevice.needs_larger_buffer(SDL_GetTicks()))
+        {
+            bool musicPaused = Mix_PausedMusic() != 0;
+            bool reopened{};
+            {
+                std::unique_lock<std::mutex> loadingPaused = musicManager.pause_loading(); // no Mix_LoadMUS() while the mixer is closed
+                reopened = audioDevice.grow_buffer(SDL_GetTicks());
+            }
+            if (reopened) // reopening halted every channel and the music
+            {
+                voiceManager.open();
+                musicManager.restart(musicPaused);
+            }
+        }
+
+        // minimised or unfocused menus are drawn no faster than backgroundFrameCap, gameplay isn't capped as
+        // slower ticks would slow the game down and desync it from the other players in multiplayer
+        bool menuScene = scene >= 1 && scene <= 31;
+        if (menuScene && (windowMinimized || !windowFocused) && backgroundFrameCap > 0 && !headlessMode)
+        {
+            int frameTime = static_cast<int>(SDL_GetTicks()) - startTime;
+            int remainingTime = 1000 / backgroundFrameCap - frameTime;
+            if (remainingTime > 0)
+            {
+                SDL_Delay(remainingTime);
+            }
+        }
 
         // FPS calculation, drawn in draw() with render_text(fps)
         frameCount++;
@@ -638,6 +759,7 @@ void exit_SDL()
     }
 
     logger.log_critical("Closing: Vectors...");
+    invalidate_button_label_textures(allButtons); // while the renderer is alive, global buttons are destroyed after it
     entities.clear();
     scene1buttons.clear();
     scene2buttons.clear();
@@ -654,30 +776,45 @@ void exit_SDL()
     allButtons.clear();
 
     logger.log_critical("Closing: sound effects...");
-    Mix_FreeChunk(moneySound);
-    Mix_FreeChunk(drinkSound);
-    Mix_FreeChunk(paperSound);
-    Mix_FreeChunk(shootSound);
-    Mix_FreeChunk(bumpSound);
-    Mix_FreeChunk(popSound);
-    Mix_FreeChunk(unlockSound);
-    Mix_FreeChunk(lockSound);
-    Mix_FreeChunk(winGameSound);
-    Mix_FreeChunk(loseGameSound);
-    Mix_FreeChunk(explosionSound);
+    voiceManager.clear(); // halt voices before their sounds are freed
+    soundBank.clear();    // every sound effect global and entity sound came from the bank
 
     logger.log_critical("Closing: music...");
-    Mix_HaltMusic();
-    Mix_FreeMusic(music);
-    Mix_CloseAudio();
+    musicManager.stop();
+    musicManager.clear();
+    audioDevice.close();
 
     logger.log_critical("Closing: textures...");
-    SDL_DestroyTexture(background1Texture);
+    textureLoader.finish(renderer); // no placeholders left in use before destroying textures
+    textureLoader.stop();
+    renderer->destroy_texture(background1Texture);
+    textCache.clear();
+    glyphAtlas.clear();
+    documentViewer.clear_textures();
+    menuCompositor.clear();
+    staticLayer.clear();
+    minimap.clear();
+    renderSnapshots.clear();
+    renderQueue.clear();
+    animationClips.clear();
 
-    logger.log_critical("Closing: window...");
-    SDL_DestroyRenderer(renderer);
     logger.log_critical("Closing: renderer...");
-    SDL_DestroyWindow(window);
+    if (headlessMode)
+    {
+        headlessRenderer.destroy();
+    }
+    else
+    {
+        renderThread.stop();
+        windowRenderer.destroy();
+    }
+    renderer = nullptr;
+    logger.log_critical("Closing: window...");
+    if (window)
+    {
+        SDL_DestroyWindow(window);
+        window = nullptr;
+    }
 
     logger.log_critical("Closing: SDL Libraries...");
     Mix_Quit();
@@ -688,6 +825,26 @@ void exit_SDL()
     logger.log_critical("Success: Quit BubbleUP game engine");
 }
 
+void wake_event_loop()
+{
+    if (wakeEventType == static_cast<Uint32>(-1))
+    {
+        return;
+    }
+    SDL_Event event{};
+    event.type = wakeEventType;
+    SDL_PushEvent(&event); // thread safe
+}
+void set_particle_frame_budget()
+{
+    SDL_DisplayMode mode{};
+    int display = SDL_GetWindowDisplayIndex(window);
+    if (display < 0 || SDL_GetCurrentDisplayMode(display, &mode) != 0 || mode.refresh_rate <= 0)
+    {
+        return;
+    }
+    particleBudget.set_frame_budget(1000.0f / static_cast<float>(mode.refresh_rate) * 1.2f);
+}
 void handle(bool gamePaused)
 {
     SDL_Event event{};
@@ -1429,6 +1586,15 @@ void handle(bool gamePaused)
                 windowMinimized = true; // stop rendering if window minimised
                 logger.log_non_critical("window minimised");
                 break;
+            case SDL_WINDOWEVENT_FOCUS_GAINED:
+                windowFocused = true; // draw at full frame rate again
+                break;
+            case SDL_WINDOWEVENT_FOCUS_LOST:
+                windowFocused = false; // draw menus at backgroundFrameCap
+                break;
+            case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+                set_particle_frame_budget(); // the new display may refresh at a different rate
+                break;
             default:
                 break;
             }
@@ -1440,7 +1606,7 @@ void update(int &soundVolume, int &musicVolume, int &scene, bool gamePaused)
     if (!gamePaused)
     {
         // Adjust SFX and Music volume
-        Mix_Volume(-1, soundVolume);  // Adjust SFX volume
+        voiceManager.set_volume(soundVolume); // Adjust SFX volume
         Mix_VolumeMusic(musicVolume); // Adjust Music volume
 
         switch (scene)
@@ -1511,145 +1677,50 @@ void update(int &soundVolume, int &musicVolume, int &scene, bool gamePaused)
             break;
         }
     }
+    voiceManager.flush(); // start this frames sound requests, one voice per sound
+    musicManager.update(); // start loaded music once the previous track has faded out
 }
-void draw(SDL_Renderer *&renderer, int &scene, SDL_Texture *&background1Texture, float fps, bool gamePaused)
+void draw(RenderBackend *renderer, int &scene, SDL_Texture *&background1Texture, float fps, bool gamePaused)
 {
     if (!gamePaused)
     {
         if (!windowMinimized)
         {
-            SDL_SetRenderDrawColor(renderer, 144, 238, 144, 255);
-            SDL_RenderClear(renderer);
+            renderer->set_draw_color(144, 238, 144, 255);
+            renderer->clear();
 
             if (windowResized)
             {
                 windowResized = false;
             }
 
-            SDL_RenderCopy(renderer, background1Texture, nullptr, nullptr); // default background for all game scenes unless overwritten in individual draw()
-
-            // Show fps
-            if (displayFPS)
+            if (is_menu_scene_cacheable(scene))
+            {
+                // static menu scenes are composed once into a texture and reused until their signature changes
+                menuCompositor.draw_scene(renderer, scene, menu_scene_signature(scene), [&]()
+                {
+                    renderer->copy(background1Texture, nullptr, nullptr);
+                    draw_menu_scene(scene);
+                });
+            }
+            else if (scene >= 1 && scene <= 31)
+            {
+                RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::MENUS);
+                renderer->copy(background1Texture, nullptr, nullptr); // default background for all game scenes unless overwritten in individual draw()
+                draw_menu_scene(scene);
+            }
+            else
             {
-                render_text("FPS: " + std::to_string(static_cast<int>(fps)), (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
+                draw_scene_gameplay(); // gameplay background is drawn per view by draw_static_layer()
             }
 
-            switch (scene)
+            // Show fps
+            if (displayFPS)
             {
-            case 1:
-                draw_scene_1();
-                break;
-            case 2:
-                draw_scene_2();
-                break;
-            case 3:
-                draw_scene_3();
-                break;
-            case 4:
-                draw_scene_4();
-                break;
-            case 5:
-                draw_scene_5();
-                break;
-            case 6:
-                draw_scene_6();
-                break;
-            case 7:
-                draw_scene_7();
-                break;
-            case 8:
-                draw_scene_8();
-                break;
-            case 9:
-                draw_scene_9();
-                break;
-            case 10:
-                draw_scene_10();
-                break;
-            case 11:
-                draw_scene_11();
-                break;
-            case 12:
-                draw_scene_12();
-                break;
-            case 13:
-                draw_scene_13();
-                break;
-            case 14:
-                draw_scene_14();
-                break;
-            case 15:
-                draw_scene_15();
-                break;
-            case 16:
-                draw_scene_16();
-                break;
-            case 17:
-                draw_scene_17();
-                break;
-            case 18:
-                draw_scene_18();
-                break;
-            case 19:
-                draw_scene_19();
-                break;
-            case 20:
-                draw_scene_20();
-                break;
-            case 21:
-                draw_scene_21();
-                break;
-            case 22:
-                draw_scene_22();
-                break;
-            case 23:
-                draw_scene_23();
-                break;
-            case 24:
-                draw_scene_24();
-                break;
-            case 25:
-                draw_scene_25();
-                break;
-            case 26:
-                draw_scene_26();
-                break;
-            case 27:
-                draw_scene_27();
-                break;
-            case 28:
-                draw_scene_28();
-                break;
-            case 29:
-                draw_scene_29();
-                break;
-            case 30:
-                draw_scene_30();
-                break;
-            case 31:
-                draw_scene_31();
-                break;
-            case 100:
-            case 101:
-            case 102:
-            case 103:
-            case 104:
-            case 105:
-            case 106:
-            case 107:
-            case 108:
-            case 109:
-            case 110:
-            case 111:
-            case 150:
-                draw_scene_gameplay();
-                break;
-            default:
-                draw_scene_gameplay();
-                break;
+                render_dynamic_text("FPS: " + std::to_string(static_cast<int>(fps)), (SCREEN_WIDTH * 0.8), (SCREEN_HEIGHT * 0.1), 0, 0, 0, 255, defaultFont);
             }
 
-            SDL_RenderPresent(renderer);
+            renderer->present();
         }
     }
 }
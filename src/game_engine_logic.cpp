@@ -36,6 +36,9 @@
 
 // FORWARD DECLARATIONS
 void render_text(const std::string &text, int x, int y, Uint8 redText, Uint8 greenText, Uint8 blueText, Uint8 alphaText, TTF_Font *font);
+void wake_event_loop();
+void load_textures();
+bool is_static_layer_entity(Entity *e);
 
 void toggle_countdown()
 {
@@ -47,6 +50,7 @@ void toggle_countdown()
             {
                 std::this_thread::sleep_for(std::chrono::seconds(1));
                 countdownSeconds--; // Decrement countdown
+                wake_event_loop();  // redraw the timer even if run_SDL() is waiting for events
                 std::cout << "Countdown: " << countdownSeconds << std::endl; // Debugging output
             }
 
@@ -128,79 +132,133 @@ std::string find_os()
 
 void draw_file_contents_to_screen(const std::string &fileToOutput)
 {
-    std::ifstream sentence_file(fileToOutput);
-    if (!sentence_file.is_open())
-    {
-        logger.log_critical("Error: Failed to open: " + fileToOutput);
-        return;
-    }
-
-    // Render position for the first line of text
-    int renderY = static_cast<int>(SCREEN_WIDTH * 0.2);
+    // first line starts at SCREEN_WIDTH * 0.2 and moves with scrollYpos, lines are wrapped to the text area width
+    SDL_Rect textArea = {static_cast<int>(SCREEN_WIDTH * 0.1), static_cast<int>(SCREEN_WIDTH * 0.2), static_cast<int>(SCREEN_WIDTH * 0.8), SCREEN_HEIGHT - static_cast<int>(SCREEN_WIDTH * 0.2)};
+    // documentViewer reports a missing file once when it's first loaded
+    documentViewer.draw(renderer, fileToOutput, textArea, scrollYpos, defaultFont, {0, 0, 0, 255});
+}
 
-    // Adjust renderY based on scrolling position
-    renderY += scrollYpos;
+void draw_minimap()
+{
+    RenderBackend::ScopedCategory category(renderer, RenderBackend::DrawCategory::HUD);
+    // whole game world scaled to MINIMAP_SIZE wide in the bottom right corner
+    int margin = static_cast<int>(SCREEN_HEIGHT * 0.02);
+    int minimapHeight = MINIMAP_SIZE * GAME_WORLD_HEIGHT / std::max(1, GAME_WORLD_WIDTH);
+    SDL_Rect area = {SCREEN_WIDTH - MINIMAP_SIZE - margin, SCREEN_HEIGHT - minimapHeight - margin, MINIMAP_SIZE, minimapHeight};
+    float scaleX = static_cast<float>(area.w) / std::max(1, GAME_WORLD_WIDTH);
+    float scaleY = static_cast<float>(area.h) / std::max(1, GAME_WORLD_HEIGHT);
+    auto to_minimap = [&](const SDL_Rect &worldRect, int minimumSize)
+    {
+        return SDL_Rect{static_cast<int>(worldRect.x * scaleX), static_cast<int>(worldRect.y * scaleY),
+                        std::max(minimumSize, static_cast<int>(worldRect.w * scaleX)), std::max(minimumSize, static_cast<int>(worldRect.h * scaleY))};
+    };
 
-    // Read lines from the file and render them to the window
-    std::string line;
-    while (std::getline(sentence_file, line))
+    // terrain only changes when staticLayer sees obstacles added, moved or removed
+    minimap.draw(renderer, area, staticLayer.get_revision(), [&]()
     {
-        if (renderY < SCREEN_HEIGHT)
+        renderer->copy(background1Texture, nullptr, nullptr);
+        std::vector<SDL_Rect> obstacleRects{};
+        for (Entity *e : entities)
         {
-            // Render only if the text is within the visible area of the window
-            if (line.size() > 80) // Check if the line is too long
+            if (is_static_layer_entity(e))
             {
-                // Split the line into two parts
-                std::string firstHalf = line.substr(0, 80); // assuming you want to split at 40 characters
-                std::string secondHalf = line.substr(80);
-
-                // Render the first half
-                render_text(firstHalf, static_cast<int>(SCREEN_WIDTH * 0.1), renderY, 0, 0, 0, 255, defaultFont);
-                renderY += 30; // Vertical spacing between lines
-
-                // Render the second half
-                if (renderY >= -30 && renderY < SCREEN_HEIGHT)
-                {
-                    render_text(secondHalf, static_cast<int>(SCREEN_WIDTH * 0.1), renderY, 0, 0, 0, 255, defaultFont);
-                    renderY += 30; // Vertical spacing between lines
-                }
+                obstacleRects.push_back(to_minimap(e->get_rect(), 1));
+            }
+        }
+        renderer->set_draw_color(90, 70, 50, 255);
+        renderer->fill_rects(obstacleRects.data(), static_cast<int>(obstacleRects.size()));
+    },
+    [&](std::vector<Minimap::Marker> &markers)
+    {
+        // only entities near the camera are marked, looked up from the spatial index
+        static std::vector<Entity *> nearbyEntities{};
+        SDL_Rect searchRect = {cameraRect.x - SCREEN_WIDTH, cameraRect.y - SCREEN_HEIGHT, SCREEN_WIDTH * 3, SCREEN_HEIGHT * 3};
+        spatialGrid.query(searchRect, nearbyEntities);
+        for (Entity *e : nearbyEntities)
+        {
+            SDL_Color color{};
+            if (Player *p = dynamic_cast<Player *>(e))
+            {
+                color = p->get_player_id() == clientPlayerID ? SDL_Color{255, 255, 255, 255} : SDL_Color{0, 200, 0, 255};
+            }
+            else if (dynamic_cast<Bot *>(e))
+            {
+                color = {0, 120, 255, 255};
+            }
+            else if (dynamic_cast<Enemy *>(e))
+            {
+                color = {220, 0, 0, 255};
+            }
+            else if (dynamic_cast<Item *>(e))
+            {
+                color = {255, 215, 0, 255};
             }
             else
             {
-                render_text(line, static_cast<int>(SCREEN_WIDTH * 0.1), renderY, 0, 0, 0, 255, defaultFont);
-                // Update render position for the next line of text
-                renderY += 30; // Vertical spacing between lines
+                continue; // obstacles are part of the terrain
             }
+            SDL_Rect marker = to_minimap(e->get_rect(), 3);
+            marker.w = marker.h = 3;
+            markers.push_back({marker, color});
         }
-        else if (renderY >= SCREEN_HEIGHT)
-        {
-            // If the text goes beyond the screen, break the loop
-            break;
-        }
-        else if (renderY < -30)
-        {
-            // Adjust renderY to prevent negative rendering
-            renderY += 30;
-        }
-    }
+    });
 
-    // Close the file
-    sentence_file.close();
-}
-
-void draw_minimap()
-{
+    // camera outline follows the player every frame
+    SDL_Rect viewOutline = to_minimap({cameraRect.x, cameraRect.y, SCREEN_WIDTH, SCREEN_HEIGHT}, 1);
+    viewOutline.x += area.x;
+    viewOutline.y += area.y;
+    renderer->set_draw_color(255, 255, 255, 255);
+    renderer->draw_rect(&viewOutline);
 }
 
 void recreate_renderer()
 {
-    SDL_DestroyRenderer(renderer);
-    if (vsyncEnabled)
+    textureLoader.finish(renderer); // pending textures would be created with the old renderer
+    textCache.clear(); // cached text textures belong to the old renderer
+    glyphAtlas.clear();
+    documentViewer.clear_textures();
+    menuCompositor.clear();
+    staticLayer.clear();
+    minimap.clear();
+    renderSnapshots.clear(); // snapshot sprites point at textures destroyed below
+    renderQueue.clear();
+    animationClips.clear_textures(); // clip and frame ids stay valid, textures are loaded again below
+    for (BaseButton *button : allButtons)
+    {
+        button->invalidate_label_texture();
+    }
+    if (headlessMode)
     {
-        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+        headlessRenderer.create(SCREEN_WIDTH, SCREEN_HEIGHT); // frees the old texture handles, vsync doesn't apply
     }
     else
     {
-        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        Uint32 flags = vsyncEnabled ? SDL_RENDERER_ACCELERATED : SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC;
+        if (renderer == &renderThread)
+        {
+            renderThread.recreate(flags); // draws the queued frames and destroys the old SDL_Renderer first
+        }
+        else
+        {
+            windowRenderer.create(window, flags); // destroys the old SDL_Renderer first
+        }
+    }
+    renderer->set_draw_blend_mode(SDL_BLENDMODE_BLEND);
+    // buttons draw with their own renderer pointer and textures, point them at the new renderer
+    for (BaseButton *button : allButtons)
+    {
+        button->set_renderer(renderer);
+        button->set_button_texture(textureLoader);
+        if (SliderButton *x = dynamic_cast<SliderButton *>(button))
+        {
+            x->set_slider_dot_texture(textureLoader);
+        }
+    }
+    animationClips.reload_textures(renderer);
+    load_textures(); // background and HUD textures were destroyed with the old renderer
+    for (Entity *e : entities)
+    {
+        e->set_renderer(renderer);
+        e->update_animation(animationClips); // static layer entities aren't animated in draw_entities()
     }
 }
\ No newline at end of file
@@ -34,6 +34,15 @@
 void load_music(const std::string &songTitle);
 void toggle_countdown();
 
+void setup_entity_assets(std::vector<Entity *> &entities)
+{
+    // every texture and sound is loaded here at level setup so draw() never reads from disk
+    for (Entity *e : entities)
+    {
+        e->preload_textures(animationClips, gen);
+        e->set_sound(soundBank, voiceManager); // entities with the same sound share one decoded copy
+    }
+}
 void setup_entities_positions(std::vector<Entity *> &entities)
 {
     // You can remove this code if you want random world map placement, or duplicate and set a floag for spawning near each other or far away
@@ -78,6 +87,8 @@ void setup_entities_positions(std::vector<Entity *> &entities)
             }
         }
     }
+
+    staticLayer.invalidate(); // new level, bake every static layer chunk again
 }
 void setup_scene_100() // Sandbox
 {
@@ -87,6 +98,7 @@ void setup_scene_100() // Sandbox
     EntityManager::create_bot_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     isMultiplayerGame = true;
     if (isMultiplayerGame) {
         webserverClientContext.POST_entity_vector_to_server(webserverHostContext, entities);
@@ -105,6 +117,7 @@ void setup_scene_101() // Tutorial
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -119,6 +132,7 @@ void setup_scene_102() // level 1
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -133,6 +147,7 @@ void setup_scene_103()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -147,6 +162,7 @@ void setup_scene_104()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -161,6 +177,7 @@ void setup_scene_105()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -175,6 +192,7 @@ void setup_scene_106()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -189,6 +207,7 @@ void setup_scene_107()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -203,6 +222,7 @@ void setup_scene_108()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -217,6 +237,7 @@ void setup_scene_109()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -231,6 +252,7 @@ void setup_scene_110()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -245,6 +267,7 @@ void setup_scene_111()
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 1);
     clientPlayerID = 1;
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     gameStarted = true;
     countdownSeconds = 300;
     startTimer = true;
@@ -265,6 +288,8 @@ void setup_reset_game()
             }
         }
     }
+    particles.clear(); // effects from the finished game
+    isMultiplayerGame = false; // set by setup_scene_100(), would keep the next local game from going split-screen
     // For drawing scores reset
     scene4inputPlayerNameButton.clear_text();
     scene4inputPlayerNameButton.set_clicked(false);
@@ -291,6 +316,7 @@ void setup_scene_multiplayer_game()
     EntityManager::random_procedural_generation(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 10, 10, 10);
     EntityManager::create_player_entity(renderer, entities, SCREEN_WIDTH, SCREEN_HEIGHT, 2);
     setup_entities_positions(entities);
+    setup_entity_assets(entities);
     countdownSeconds = 300;
     startTimer = true;
     toggle_countdown();
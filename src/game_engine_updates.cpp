@@ -29,10 +29,12 @@
 #include "../headers/game_engine_updates.hpp"
 #include "../headers/game_engine_setups.hpp"
 #include "../headers/game_engine_logic.hpp"
+#include <algorithm> // for std::max, std::min, std::sort, std::unique
 
 // Forward declarations
 void initialise_score();
 struct score;
+bool is_static_layer_entity(Entity *e);
 
 void update_camera_collissions_logic()
 {
@@ -219,6 +221,8 @@ void update_scene_gameplay() // Sandbox
         webserverClientContext.GET_network_messages(entities, webserverHostContext);
     }
 
+    static std::vector<Player *> players{}; // found while moving entities so the snapshot doesn't search for them again
+    players.clear();
     for (Entity *e : entities)
     {
         // handle collisions
@@ -248,6 +252,7 @@ void update_scene_gameplay() // Sandbox
 
         if (Player *p = dynamic_cast<Player *>(e))
         {
+            players.push_back(p);
             int cameraZoom = 1; // can change to global variable to control camera zoom in future
             // camera follows player
             cameraRect.x = p->get_rect().x * cameraZoom;
@@ -260,6 +265,7 @@ void update_scene_gameplay() // Sandbox
                 if (p->get_health() <= 0) // LOSE logic
                 {
                     std::cout << "Game over" << std::endl;
+                    players.pop_back();
                     delete p; // kick player out
                     setup_reset_game();
                     scene = 4; // post their score locally or to webserver
@@ -278,5 +284,154 @@ void update_scene_gameplay() // Sandbox
             }
         }
     }
-    // LAST - In draw() -> draw entities. Then start loop again from top
+
+    // index entities where they ended up this update for draw() lookups e.g. minimap markers
+    spatialGrid.rebuild(entities, GAME_WORLD_WIDTH, GAME_WORLD_HEIGHT);
+
+    // publish what draw() should show this tick, particles are moved and culled against its views
+    update_render_snapshot(players);
+
+    // LAST - In draw() -> draw entities from the render snapshot. Then start loop again from top
+}
+SDL_Rect get_split_screen_rect(int index, int viewCount)
+{
+    if (viewCount <= 1)
+    {
+        return {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+    }
+    if (viewCount == 2)
+    {
+        // side by side halves
+        return {index * (SCREEN_WIDTH / 2), 0, SCREEN_WIDTH / 2, SCREEN_HEIGHT};
+    }
+    // 3 or 4 players get quarters, top left, top right, bottom left, bottom right
+    return {(index % 2) * (SCREEN_WIDTH / 2), (index / 2) * (SCREEN_HEIGHT / 2), SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2};
+}
+void update_split_screen_views(RenderSnapshots::Snapshot &snapshot, const std::vector<Player *> &localPlayers)
+{
+    static std::vector<Entity *> visible{}; // keeps its capacity between ticks
+    static std::vector<Entity *> drawn{};   // every views sprites' entities, to count ones on several views once
+    drawn.clear();
+    int viewCount = static_cast<int>(localPlayers.size());
+    for (int i = 0; i < viewCount; i++)
+    {
+        RenderSnapshots::View view{};
+        view.screen = get_split_screen_rect(i, viewCount);
+
+        // each view's camera is centred on its player and kept inside the game world
+        SDL_Rect playerRect = localPlayers[i]->get_rect();
+        view.camera = {playerRect.x + playerRect.w / 2 - view.screen.w / 2, playerRect.y + playerRect.h / 2 - view.screen.h / 2, view.screen.w, view.screen.h};
+        view.camera.x = std::max(0, std::min(view.camera.x, GAME_WORLD_WIDTH - view.camera.w));
+        view.camera.y = std::max(0, std::min(view.camera.y, GAME_WORLD_HEIGHT - view.camera.h));
+
+        // only the spatial grid cells under the camera are visited, not every entity per view
+        spatialGrid.query(view.camera, visible);
+        view.firstSprite = snapshot.sprites.size();
+        for (Entity *e : visible)
+        {
+            if (staticLayer.is_baked(e))
+            {
+                continue;
+            }
+            e->update_animation(animationClips);
+            snapshot.sprites.push_back({e->get_texture(), {e->get_rect().x - view.camera.x, e->get_rect().y - view.camera.y, e->get_rect().w, e->get_rect().h}, e->get_z_pos()});
+            drawn.push_back(e);
+        }
+        view.spriteCount = snapshot.sprites.size() - view.firstSprite;
+        snapshot.views.push_back(view);
+    }
+    std::sort(drawn.begin(), drawn.end());
+    snapshot.entitiesDrawn = static_cast<int>(std::unique(drawn.begin(), drawn.end()) - drawn.begin());
+}
+void update_particles(const RenderSnapshots::Snapshot &snapshot)
+{
+    if (snapshot.views.empty())
+    {
+        return;
+    }
+    // one rect around every views camera, a particle on any view is kept
+    SDL_Rect cullRect = snapshot.views[0].camera;
+    for (size_t i = 1; i < snapshot.views.size(); i++)
+    {
+        SDL_UnionRect(&cullRect, &snapshot.views[i].camera, &cullRect);
+    }
+    particles.update(cullRect);
+}
+void update_sound_listeners(const RenderSnapshots::Snapshot &snapshot)
+{
+    for (size_t i = 0; i < snapshot.views.size(); i++)
+    {
+        const SDL_Rect &camera = snapshot.views[i].camera;
+        float x = camera.x + camera.w / 2.0f;
+        float y = camera.y + camera.h / 2.0f;
+        if (i == 0)
+        {
+            voiceManager.set_listener(x, y);
+        }
+        else
+        {
+            voiceManager.add_listener(x, y);
+        }
+    }
+}
+void update_render_snapshot(const std::vector<Player *> &players)
+{
+    static std::vector<Entity *> visible{}; // keeps its capacity between ticks
+    // visible region of the game world, entities outside of it are culled before any animation/texture work
+    SDL_Rect viewRect = {cameraRect.x, cameraRect.y, SCREEN_WIDTH, SCREEN_HEIGHT};
+    staticLayer.update(entities, is_static_layer_entity);
+    animationClips.advance(SDL_GetTicks()); // one animation clock for every entity this tick
+
+    RenderSnapshots::Snapshot &snapshot = renderSnapshots.begin_write();
+    snapshot.entitiesTotal = static_cast<int>(entities.size());
+
+    // every player on this machine gets a view when more than one is playing, network players are remote and
+    // bots are Player subclasses that nobody is controlling
+    std::vector<Player *> localPlayers{};
+    if (!isMultiplayerGame)
+    {
+        for (Player *player : players)
+        {
+            if (dynamic_cast<Bot *>(player) == nullptr && localPlayers.size() < 4)
+            {
+                localPlayers.push_back(player);
+            }
+        }
+    }
+    if (localPlayers.size() > 1)
+    {
+        update_split_screen_views(snapshot, localPlayers);
+        update_particles(snapshot);
+        update_sound_listeners(snapshot);
+        renderSnapshots.publish();
+        return;
+    }
+
+    snapshot.views.push_back({{0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}, viewRect, 0, 0});
+    // the client player is the camera target so it is always drawn
+    for (Player *player : players)
+    {
+        if (player->get_player_id() == clientPlayerID)
+        {
+            player->update_animation(animationClips);
+            snapshot.sprites.push_back({player->get_texture(), {cameraRect.x, cameraRect.y, player->get_rect().w, player->get_rect().h}, player->get_z_pos()});
+        }
+    }
+    // only the spatial grid cells under the camera are visited, not every entity in the world
+    spatialGrid.query(viewRect, visible);
+    for (Entity *e : visible)
+    {
+        if (dynamic_cast<Player *>(e) || staticLayer.is_baked(e))
+        {
+            continue;
+        }
+        // entities displaced by the camera position
+        e->update_animation(animationClips);
+        snapshot.sprites.push_back({e->get_texture(), {e->get_rect().x - viewRect.x, e->get_rect().y - viewRect.y, e->get_rect().w, e->get_rect().h}, e->get_z_pos()});
+    }
+    snapshot.views.back().spriteCount = snapshot.sprites.size();
+    snapshot.entitiesDrawn = static_cast<int>(snapshot.sprites.size());
+    update_particles(snapshot);
+    update_sound_listeners(snapshot);
+    renderSnapshots.publish();
 }
\ No newline at end of file
@@ -36,7 +36,7 @@
 
 // Standard SDL Library
 SDL_Window *window{};
-SDL_Renderer *renderer{};
+RenderBackend *renderer{}; // renderThread (windowRenderer where unsupported), or headlessRenderer when headlessMode, every draw goes through it
 
 // Textures
 SDL_Texture *background1Texture{};
@@ -99,7 +99,11 @@ TTF_Font *geezBoldfont36{};
 TTF_Font *geezBoldfont48{};
 
 // SDL_Mixer
-Mix_Music *music{};
+AudioDevice audioDevice(44100, 2); // the only place the mixer is opened and closed, 44100Hz stereo
+AudioDevice::Profile audioProfile = AudioDevice::Profile::LOW_LATENCY; // 256-1024 frame buffer, STANDARD for the old 4096 frames, set at compile time, not saved with the settings
+SoundBank soundBank{}; // sound effects decoded once per file path, shared by globals, entities and the level editor
+VoiceManager voiceManager(16, 2, 1600.0f); // 16 mixer channels, at most 2 voices of the same sound unless set in load_sounds(), entity sounds heard up to 1600px from the camera centre
+MusicManager musicManager(500); // background music loaded on its own thread, 500ms fades between tracks
 Mix_Chunk *treeSound{};
 Mix_Chunk *waterSound{};
 Mix_Chunk *barkSound{};
@@ -137,6 +141,8 @@ int SCREEN_WIDTH = 1280;
 int SCREEN_HEIGHT = 720;
 int MINIMAP_SIZE = 200;
 SDL_Rect cameraRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+int entitiesDrawnCount{}; // entities drawn after camera culling in draw_entities() for draw_debug_overlay()
+int entitiesTotalCount{}; // all entities in the game world for draw_debug_overlay()
 std::string currentResolution = "Resolution: " + std::to_string(SCREEN_WIDTH) + "x" + std::to_string(SCREEN_HEIGHT);
 float acceleration = 0.5f;
 float deceleration = 0.01f;
@@ -170,6 +176,13 @@ bool displayOnScreenKeys{}; // for mobile games toggle in settings menu to show
 bool displayFPS{};          // for settings menu option to show FPS on screen
 bool windowResized{};       // for SDL handle key input WIDOW minimised/maximised or resized event to update window*
 bool windowMinimized{};     // for SDL handle key input WIDOW minimised event to pause rendering when minimised
+unsigned int menuGeneration{}; // increased by upload_loaded_textures() so menuCompositor rebuilds the menu scene
+bool windowFocused = true;     // for SDL handle WINDOW focus events, unfocused menus are drawn at backgroundFrameCap
+int backgroundFrameCap = 10;   // max FPS of menu scenes while minimised or unfocused, 0 for no cap
+int idleWaitTimeout = 500;     // max ms run_SDL() sleeps waiting for an event on static menu scenes
+Uint32 wakeEventType = static_cast<Uint32>(-1); // SDL user event registered in start_SDL() to wake run_SDL() from other threads
+bool headlessMode{};           // set before or by start_SDL() when SDL_VIDEODRIVER=dummy, no window, audio or rasterising, draws are recorded by headlessRenderer
+int headlessTickLimit{};       // headless run_SDL() returns after this many ticks, 0 to run until quit
 bool isMultiplayerGame{};
 int clientPlayerID{};
 std::mt19937 gen(std::random_device{}());                    // for bot simulation
@@ -196,7 +209,8 @@ std::map<std::string, std::map<std::string, std::string>> languageTranslations =
     {"日本語", {{"change_font_txt", "フォントを変更する"}, {"change_language_txt", "言語を変えてください"}, {"enter_name_txt", "ENTER NAME"}, {"high_score_txt", "名前を入力"}, {"new_game_txt", "新しいゲーム"}, {"player_txt", "プレーヤー"}, {"quit_game_txt", "ゲームをやめる"}, {"return_txt", "戻る"}, {"score_txt", "スコア"}, {"settings_txt", "設定"}, {"sound_control_txt", "サウンドコントロール"}, {"volume_control_txt", "音量調節"}}}};
 
 std::vector<Entity *> entities{};
-std::vector<ParticleGenerator> particles{};
+ParticleBudget particleBudget(4096, 20.0f); // particle cap by priority, bursts thinned while frames run over budget, 20ms until set_particle_frame_budget() reads the display
+ParticleGenerator particles(4096, ParticleGenerator::OverflowPolicy::OVERWRITE, &particleBudget); // fixed pool, new bursts overwrite old particles when full
 
 // Scene 1 - Main Menu
 /*
@@ -780,6 +794,7 @@ InputButton scene8inputpasswordButton{
     "assets/graphics/boxes/button.png",     // Button texture path
     defaultFont,                            // Button font
     0, 0, 0, 255,                           // Text color (RGBA)
+    true,                                   // masked, typed password drawn as *
 };
 // scene 9 - Create account
 ClickableButton scene9returnToTitleButton{
@@ -834,6 +849,7 @@ InputButton scene9inputpasswordNameButton{
     "assets/graphics/boxes/button.png",     // Button texture path
     defaultFont,                            // Button font
     0, 0, 0, 255,                           // Text color (RGBA)
+    true,                                   // masked, typed password drawn as *
 };
 // scene 10 - Show policies
 // scene 11 - Multiplayer lobby
@@ -1409,6 +1425,8 @@ std::vector<BaseButton *> sceneGameplaybuttons{};
 std::vector<BaseButton *> allButtons{};
 
 BaseButton *BaseButton::selectedButton{};
+bool BaseButton::recordingDrawnButtons{};
+std::vector<std::pair<BaseButton *, SDL_Rect>> BaseButton::drawnButtons{};
 
 std::vector<Score> scores{};
 
@@ -1416,6 +1434,21 @@ UpdateApp updateApp = {softwareVersion, "https://github.com/sumeet_chand/BubbleU
                        "https://github.com/sumeet_chand/BubbleUp/archive/refs/heads/main.zip", "", saveFileName, "BubbleUp.exe", "BubbleUp"};
 
 DebugLogging logger("game_log.txt");
+TextureLoader textureLoader(4 * 1024 * 1024); // decodes images on worker threads, uploads up to 4MB of pixels per frame
+
+TextCache textCache(8 * 1024 * 1024); // 8MB of rendered text textures for render_text()
+GlyphAtlas glyphAtlas{};            // per font glyph atlas for render_dynamic_text()
+DocumentViewer documentViewer{};    // help, credits and policy documents for draw_file_contents_to_screen()
+MenuCompositor menuCompositor{};    // cached menu scene textures for draw()
+AnimationClips animationClips(textureLoader); // entity animation frames shared by every entity with the same textures
+StaticLayer staticLayer(512);       // gameplay obstacles baked into 512x512 game world chunks
+SpatialGrid spatialGrid(256);       // entities by 256x256 game world cell, rebuilt every gameplay update
+Minimap minimap(100);               // minimap terrain texture with entity markers refreshed at 10Hz
+RenderSnapshots renderSnapshots{}; // gameplay sprites published by update() for draw()
+RenderThread renderThread{};       // creates the windows SDL_Renderer on its own thread and replays the frames draw() records
+WindowRenderer windowRenderer{};   // SDL_Renderer of the window on the main thread where RenderThread::is_supported() is false
+HeadlessRenderer headlessRenderer{}; // records draw calls without a window or GPU for headless runs
+RenderQueue renderQueue{};         // gameplay draws sorted by layer, zPos and texture before submitting
 
 WebserverClient webserverClientContext{};
 WebserverHost webserverHostContext{};
\ No newline at end of file
@@ -26,7 +26,9 @@ protected:
     {
         logger.clear_log_file();
         logger.log_critical("Starting Software");
-        start_SDL(); // will play 10 second cinematic
+        headlessMode = true;     // no window, audio device or intro cinematic, draws are recorded by headlessRenderer
+        headlessTickLimit = 100; // run_SDL() returns after 100 ticks
+        start_SDL();
         run_SDL();
     }
 
@@ -82,6 +84,83 @@ TEST_F(mainTest, check_logs_for_errors)
     EXPECT_EQ(returnCode, 0);
 }
 
+/**
+ * @brief test - headless renderer presented every tick and counted the draw calls
+ *
+ * The game starts on the main menu so the menu buttons and title text are drawn, nothing is rasterised
+ *
+ */
+TEST_F(mainTest, headless_renderer_records_frames)
+{
+    std::cout << "Running test headless_renderer_records_frames" << std::endl;
+    ASSERT_EQ(renderer, &headlessRenderer);
+    EXPECT_GT(headlessRenderer.get_frame_count(), 0ULL);
+    EXPECT_LE(headlessRenderer.get_frame_count(), static_cast<unsigned long long>(headlessTickLimit));
+    EXPECT_GT(headlessRenderer.get_total_draw_calls(RenderBackend::DrawCategory::MENUS), 0ULL);
+    EXPECT_GT(headlessRenderer.get_total_draw_calls(RenderBackend::DrawCategory::TEXT), 0ULL);
+    EXPECT_FALSE(headlessRenderer.get_last_frame_commands().empty());
+    EXPECT_GT(headlessRenderer.get_texture_count(), 0u);
+}
+
+/**
+ * @brief benchmark - particle update kernel at 1 million particles
+ *
+ * Disabled so it doesn't slow the unit tests, run it with --gtest_also_run_disabled_tests and read the time
+ * gtest reports for it. Doesn't need SDL started. Build with -mavx2 to compare against SSE2
+ *
+ */
+TEST(particleBenchmark, DISABLED_update_one_million_particles)
+{
+    std::cout << "Running test update_one_million_particles" << std::endl;
+    ParticleGenerator pool(1000000, ParticleGenerator::OverflowPolicy::DROP_NEW);
+    pool.emit(ParticlePreset::FIRE, 0, 0, 1000000);
+    EXPECT_EQ(pool.get_count(), 1000000u);
+
+    SDL_Rect cullRect = {-100000, -100000, 200000, 200000}; // nothing leaves it in 10 updates
+    for (int i = 0; i < 10; i++)
+    {
+        pool.update(cullRect);
+    }
+    EXPECT_EQ(pool.get_count(), 1000000u);
+
+    // a cull rect nothing is inside removes everything in one sweep
+    pool.update({0, 0, 0, 0});
+    EXPECT_EQ(pool.get_count(), 0u);
+}
+
+/**
+ * @brief test - SIMD particle update matches the scalar loop
+ *
+ * 1003 particles leaves a remainder after the last 8 (AVX2) or 4 (SSE2) wide block, some are emitted near the
+ * cull rect edges so they're removed part way through a block
+ *
+ */
+TEST(particleGenerator, simd_update_matches_scalar)
+{
+    std::cout << "Running test simd_update_matches_scalar" << std::endl;
+    ParticleGenerator simd(1003, ParticleGenerator::OverflowPolicy::DROP_NEW);
+    simd.emit(ParticlePreset::FIRE, 500, 500, 1000);
+    simd.emit(ParticlePreset::WATER, 2, 500, 2);
+    simd.emit(ParticlePreset::FIREWORKS, 997, 990, 1);
+    ParticleGenerator scalar = simd; // same particles and random state
+    ASSERT_EQ(simd.get_count(), 1003u);
+
+    SDL_Rect cullRect = {0, 0, 1000, 1000};
+    for (int update = 0; update < 60; update++)
+    {
+        simd.update(cullRect);
+        scalar.update_scalar(cullRect);
+        ASSERT_EQ(simd.get_count(), scalar.get_count()) << "after update " << update;
+        for (size_t i = 0; i < simd.get_count(); i++)
+        {
+            ASSERT_EQ(simd.get_x(i), scalar.get_x(i)) << "particle " << i << " after update " << update;
+            ASSERT_EQ(simd.get_y(i), scalar.get_y(i)) << "particle " << i << " after update " << update;
+            ASSERT_EQ(simd.get_life(i), scalar.get_life(i)) << "particle " << i << " after update " << update;
+        }
+    }
+    EXPECT_LT(simd.get_count(), 1003u); // the edge particles were culled
+}
+
 int main(int argc, char *argv[])
 {
     ::testing::InitGoogleTest(&argc, argv);